@@ -0,0 +1,96 @@
+/*
+# This code is part of Qiskit.
+#
+# (C) Copyright IBM 2026.
+#
+# This code is licensed under the Apache License, Version 2.0. You may
+# obtain a copy of this license in the LICENSE.txt file in the root directory
+# of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# Any modifications or derivative works of this code must retain this
+# copyright notice, and modified files need to carry a notice indicating
+# that they have been altered from the originals.
+*/
+
+// Benchmark of per-gate methods vs QuantumCircuit::append_batch
+
+#include <iostream>
+#include <cstdint>
+#include <cstdlib>
+#include <chrono>
+
+#include "circuit/quantumcircuit.hpp"
+
+using namespace Qiskit;
+using namespace Qiskit::circuit;
+
+// QAOA-like layers: rzz on a ring followed by rx mixer
+static void build_per_gate(QuantumCircuit &circ, uint_t num_qubits, uint_t num_layers)
+{
+  for (uint_t l = 0; l < num_layers; l++) {
+    for (uint_t i = 0; i < num_qubits; i++) {
+      circ.rzz(0.1 * (l + 1), i, (i + 1) % num_qubits);
+    }
+    for (uint_t i = 0; i < num_qubits; i++) {
+      circ.rx(0.2 * (l + 1), i);
+    }
+  }
+}
+
+static void build_batch(QuantumCircuit &circ, uint_t num_qubits, uint_t num_layers)
+{
+  std::vector<QkGate> gates;
+  std::vector<std::uint32_t> qubits;
+  std::vector<double> params;
+  gates.reserve(num_layers * num_qubits * 2);
+  qubits.reserve(num_layers * num_qubits * 3);
+  params.reserve(num_layers * num_qubits * 2);
+
+  for (uint_t l = 0; l < num_layers; l++) {
+    for (uint_t i = 0; i < num_qubits; i++) {
+      gates.push_back(QkGate_RZZ);
+      qubits.push_back((std::uint32_t)i);
+      qubits.push_back((std::uint32_t)((i + 1) % num_qubits));
+      params.push_back(0.1 * (l + 1));
+    }
+    for (uint_t i = 0; i < num_qubits; i++) {
+      gates.push_back(QkGate_RX);
+      qubits.push_back((std::uint32_t)i);
+      params.push_back(0.2 * (l + 1));
+    }
+  }
+  circ.append_batch(gates, qubits, params);
+}
+
+int main(int argc, char **argv)
+{
+  uint_t num_qubits = 100;
+  uint_t num_layers = 2500;   // 500k gates
+  if (argc > 1)
+    num_qubits = strtoul(argv[1], NULL, 10);
+  if (argc > 2)
+    num_layers = strtoul(argv[2], NULL, 10);
+  uint_t num_gates = num_qubits * num_layers * 2;
+
+  QuantumCircuit circ_gate(num_qubits, 0);
+  auto start = std::chrono::steady_clock::now();
+  build_per_gate(circ_gate, num_qubits, num_layers);
+  double t_gate = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  QuantumCircuit circ_batch(num_qubits, 0);
+  start = std::chrono::steady_clock::now();
+  build_batch(circ_batch, num_qubits, num_layers);
+  double t_batch = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  std::cout << "gates : " << num_gates << " on " << num_qubits << " qubits" << std::endl;
+  std::cout << "per-gate methods : " << t_gate << " sec, " << num_gates / t_gate << " gates/sec" << std::endl;
+  std::cout << "append_batch     : " << t_batch << " sec, " << num_gates / t_batch << " gates/sec" << std::endl;
+  std::cout << "speedup          : " << t_gate / t_batch << std::endl;
+
+  if (circ_gate != circ_batch) {
+    std::cerr << "ERROR : circuits built by per-gate methods and append_batch differ" << std::endl;
+    return 1;
+  }
+  return 0;
+}
+
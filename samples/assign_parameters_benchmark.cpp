@@ -0,0 +1,115 @@
+/*
+# This code is part of Qiskit.
+#
+# (C) Copyright IBM 2026.
+#
+# This code is licensed under the Apache License, Version 2.0. You may
+# obtain a copy of this license in the LICENSE.txt file in the root directory
+# of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# Any modifications or derivative works of this code must retain this
+# copyright notice, and modified files need to carry a notice indicating
+# that they have been altered from the originals.
+*/
+
+// Benchmark of QuantumCircuit::bind_parameters vs rebuilding a circuit with values
+
+#include <iostream>
+#include <cstdint>
+#include <cstdlib>
+#include <chrono>
+#include <string>
+
+#include "circuit/quantumcircuit.hpp"
+
+using namespace Qiskit;
+using namespace Qiskit::circuit;
+
+// hardware efficient ansatz: ry, rz on each qubit followed by a cx chain
+static void build_template(QuantumCircuit &circ, uint_t num_qubits, uint_t num_layers)
+{
+  uint_t k = 0;
+  for (uint_t l = 0; l < num_layers; l++) {
+    for (uint_t i = 0; i < num_qubits; i++) {
+      circ.ry(Parameter("t[" + std::to_string(k++) + "]"), i);
+      circ.rz(Parameter("t[" + std::to_string(k++) + "]"), i);
+    }
+    for (uint_t i = 0; i + 1 < num_qubits; i++) {
+      circ.cx(i, i + 1);
+    }
+  }
+}
+
+static void build_bound(QuantumCircuit &circ, uint_t num_qubits, uint_t num_layers, const std::vector<double> &values)
+{
+  uint_t k = 0;
+  for (uint_t l = 0; l < num_layers; l++) {
+    for (uint_t i = 0; i < num_qubits; i++) {
+      circ.ry(values[k++], i);
+      circ.rz(values[k++], i);
+    }
+    for (uint_t i = 0; i + 1 < num_qubits; i++) {
+      circ.cx(i, i + 1);
+    }
+  }
+}
+
+int main(int argc, char **argv)
+{
+  uint_t num_qubits = 50;
+  uint_t num_layers = 10;     // 1000 parameters
+  uint_t num_binds = 100;
+  if (argc > 1)
+    num_qubits = strtoul(argv[1], NULL, 10);
+  if (argc > 2)
+    num_layers = strtoul(argv[2], NULL, 10);
+  if (argc > 3)
+    num_binds = strtoul(argv[3], NULL, 10);
+  uint_t num_params = num_qubits * num_layers * 2;
+
+  QuantumCircuit templ(num_qubits, 0);
+  build_template(templ, num_qubits, num_layers);
+  std::vector<std::vector<double>> values(num_binds, std::vector<double>(num_params));
+  for (uint_t b = 0; b < num_binds; b++) {
+    for (uint_t i = 0; i < num_params; i++) {
+      values[b][i] = 0.001 * (b + 1) * (i + 1);
+    }
+  }
+
+  // values are given in the circuit parameter order, map them to t[k]
+  auto names = templ.parameter_names();
+  std::vector<uint_t> order(num_params);
+  for (uint_t i = 0; i < num_params; i++) {
+    order[i] = strtoul(names[i].c_str() + 2, NULL, 10);
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  QuantumCircuit last_rebuilt;
+  for (uint_t b = 0; b < num_binds; b++) {
+    QuantumCircuit circ(num_qubits, 0);
+    build_bound(circ, num_qubits, num_layers, values[b]);
+    last_rebuilt = circ;
+  }
+  double t_rebuild = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  std::vector<double> ordered(num_params);
+  start = std::chrono::steady_clock::now();
+  QuantumCircuit last_bound;
+  for (uint_t b = 0; b < num_binds; b++) {
+    for (uint_t i = 0; i < num_params; i++) {
+      ordered[i] = values[b][order[i]];
+    }
+    last_bound = templ.bind_parameters(ordered);
+  }
+  double t_bind = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  std::cout << "parameters : " << num_params << ", instructions : " << templ.num_instructions() << ", bindings : " << num_binds << std::endl;
+  std::cout << "rebuild with values : " << t_rebuild << " sec, " << num_binds / t_rebuild << " circuits/sec" << std::endl;
+  std::cout << "bind_parameters     : " << t_bind << " sec, " << num_binds / t_bind << " circuits/sec" << std::endl;
+
+  if (last_rebuilt != last_bound) {
+    std::cerr << "ERROR : bound circuit differs from the rebuilt circuit" << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,90 @@
+/*
+# This code is part of Qiskit.
+#
+# (C) Copyright IBM 2026.
+#
+# This code is licensed under the Apache License, Version 2.0. You may
+# obtain a copy of this license in the LICENSE.txt file in the root directory
+# of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# Any modifications or derivative works of this code must retain this
+# copyright notice, and modified files need to carry a notice indicating
+# that they have been altered from the originals.
+*/
+
+// Benchmark of per-bit loops vs register-wide gates, measure and reset
+
+#include <iostream>
+#include <cstdint>
+#include <cstdlib>
+#include <chrono>
+
+#include "circuit/quantumcircuit.hpp"
+
+using namespace Qiskit;
+using namespace Qiskit::circuit;
+
+// reset, h, rz prologue and measure epilogue on every qubit
+static void build_per_bit(QuantumCircuit &circ, uint_t num_qubits, uint_t num_rounds)
+{
+  for (uint_t r = 0; r < num_rounds; r++) {
+    for (uint_t i = 0; i < num_qubits; i++) {
+      circ.reset(i);
+    }
+    for (uint_t i = 0; i < num_qubits; i++) {
+      circ.h(i);
+    }
+    for (uint_t i = 0; i < num_qubits; i++) {
+      circ.rz(0.1 * (r + 1), i);
+    }
+    for (uint_t i = 0; i < num_qubits; i++) {
+      circ.measure(i, i);
+    }
+  }
+}
+
+static void build_register(QuantumCircuit &circ, QuantumRegister &qr, ClassicalRegister &cr, uint_t num_rounds)
+{
+  for (uint_t r = 0; r < num_rounds; r++) {
+    circ.reset(qr);
+    circ.h(qr);
+    circ.rz(0.1 * (r + 1), qr);
+    circ.measure(qr, cr);
+  }
+}
+
+int main(int argc, char **argv)
+{
+  uint_t num_qubits = 156;
+  uint_t num_rounds = 1000;
+  if (argc > 1)
+    num_qubits = strtoul(argv[1], NULL, 10);
+  if (argc > 2)
+    num_rounds = strtoul(argv[2], NULL, 10);
+  uint_t num_ops = num_qubits * num_rounds * 4;
+
+  auto qr_bit = QuantumRegister(num_qubits, std::string("q"));
+  auto cr_bit = ClassicalRegister(num_qubits, std::string("c"));
+  QuantumCircuit circ_bit(qr_bit, cr_bit);
+  auto start = std::chrono::steady_clock::now();
+  build_per_bit(circ_bit, num_qubits, num_rounds);
+  double t_bit = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  auto qr = QuantumRegister(num_qubits, std::string("q"));
+  auto cr = ClassicalRegister(num_qubits, std::string("c"));
+  QuantumCircuit circ_reg(qr, cr);
+  start = std::chrono::steady_clock::now();
+  build_register(circ_reg, qr, cr, num_rounds);
+  double t_reg = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  std::cout << "operations : " << num_ops << " on " << num_qubits << " qubits" << std::endl;
+  std::cout << "per-bit loops    : " << t_bit << " sec, " << num_ops / t_bit << " ops/sec" << std::endl;
+  std::cout << "register-wide    : " << t_reg << " sec, " << num_ops / t_reg << " ops/sec" << std::endl;
+  std::cout << "speedup          : " << t_bit / t_reg << std::endl;
+
+  if (circ_bit != circ_reg) {
+    std::cerr << "ERROR : circuits built by per-bit loops and register-wide methods differ" << std::endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,100 @@
+/*
+# This code is part of Qiskit.
+#
+# (C) Copyright IBM 2026.
+#
+# This code is licensed under the Apache License, Version 2.0. You may
+# obtain a copy of this license in the LICENSE.txt file in the root directory
+# of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# Any modifications or derivative works of this code must retain this
+# copyright notice, and modified files need to carry a notice indicating
+# that they have been altered from the originals.
+*/
+
+// Benchmark of QuantumCircuit::compose stitching sub-circuits into a wide circuit
+
+#include <iostream>
+#include <cstdint>
+#include <cstdlib>
+#include <chrono>
+
+#include "circuit/quantumcircuit.hpp"
+
+using namespace Qiskit;
+using namespace Qiskit::circuit;
+
+// 4-qubit block with standard gates, a unitary and measurements
+static QuantumCircuit make_block(uint_t depth)
+{
+    const uint_t width = 4;
+    QuantumCircuit block(width, width);
+    std::vector<complex_t> cz_mat(16, 0.0);
+    cz_mat[0] = cz_mat[5] = cz_mat[10] = 1.0;
+    cz_mat[15] = -1.0;
+
+    for (uint_t d = 0; d < depth; d++) {
+        for (uint_t i = 0; i < width; i++) {
+            block.rz(0.1 * (d + 1), i);
+            block.sx(i);
+        }
+        block.cx(0, 1);
+        block.cx(2, 3);
+        block.unitary(cz_mat, reg_t({1, 2}));
+    }
+    for (uint_t i = 0; i < width; i++) {
+        block.measure(i, i);
+    }
+    return block;
+}
+
+static double run(QuantumCircuit &wide, QuantumCircuit &block, uint_t num_blocks, bool identity)
+{
+    const uint_t width = block.num_qubits();
+    reg_t qubits(width);
+    reg_t clbits(width);
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint_t b = 0; b < num_blocks; b++) {
+        uint_t base = identity ? 0 : (b * width) % (wide.num_qubits() - width + 1);
+        for (uint_t i = 0; i < width; i++) {
+            // reverse order of qubits in each block if not identity
+            qubits[i] = identity ? i : base + width - 1 - i;
+            clbits[i] = identity ? i : base + i;
+        }
+        wide.compose(block, qubits, clbits);
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv)
+{
+    uint_t num_qubits = 1000;
+    uint_t num_blocks = 2000;
+    uint_t depth = 10;
+    if (argc > 1)
+        num_qubits = strtoul(argv[1], NULL, 10);
+    if (argc > 2)
+        num_blocks = strtoul(argv[2], NULL, 10);
+    if (argc > 3)
+        depth = strtoul(argv[3], NULL, 10);
+
+    auto block = make_block(depth);
+    uint_t num_ops = num_blocks * block.num_instructions();
+
+    QuantumCircuit wide_identity(num_qubits, num_qubits);
+    double t_identity = run(wide_identity, block, num_blocks, true);
+
+    QuantumCircuit wide_mapped(num_qubits, num_qubits);
+    double t_mapped = run(wide_mapped, block, num_blocks, false);
+
+    std::cout << "blocks : " << num_blocks << " x " << block.num_instructions() << " instructions into " << num_qubits << " qubits" << std::endl;
+    std::cout << "identity mapping : " << t_identity << " sec, " << num_ops / t_identity << " instructions/sec" << std::endl;
+    std::cout << "remapped         : " << t_mapped << " sec, " << num_ops / t_mapped << " instructions/sec" << std::endl;
+
+    if (wide_identity.num_instructions() != num_ops || wide_mapped.num_instructions() != num_ops) {
+        std::cerr << "ERROR : composed circuits have wrong number of instructions" << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,118 @@
+/*
+# This code is part of Qiskit.
+#
+# (C) Copyright IBM 2026.
+#
+# This code is licensed under the Apache License, Version 2.0. You may
+# obtain a copy of this license in the LICENSE.txt file in the root directory
+# of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# Any modifications or derivative works of this code must retain this
+# copyright notice, and modified files need to carry a notice indicating
+# that they have been altered from the originals.
+*/
+
+// Benchmark of allocations to build a parameterized ansatz with expressions
+
+#include <iostream>
+#include <cstdint>
+#include <cstdlib>
+#include <chrono>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "circuit/quantumcircuit.hpp"
+
+using namespace Qiskit;
+using namespace Qiskit::circuit;
+
+// count C++ heap allocations
+// This is only a proxy of QkParam creations: each QkParam held by a Parameter
+// allocates one shared_ptr control block, but allocations made inside the
+// Qiskit C library (QkParam objects and their expression trees) are not seen here.
+static uint_t num_allocations = 0;
+
+void *operator new(std::size_t size)
+{
+  num_allocations++;
+  void *p = std::malloc(size ? size : 1);
+  if (p == nullptr)
+    throw std::bad_alloc();
+  return p;
+}
+
+void operator delete(void *p) noexcept
+{
+  std::free(p);
+}
+
+// ry(2 * theta[k] + phi), rz(theta[k] / 2 - phi) on each qubit followed by a cx chain
+static void build_ansatz(QuantumCircuit &circ, const std::vector<Parameter> &theta, const Parameter &phi, uint_t num_qubits, uint_t num_layers)
+{
+  uint_t k = 0;
+  for (uint_t l = 0; l < num_layers; l++) {
+    for (uint_t i = 0; i < num_qubits; i++) {
+      circ.ry(theta[k] * 2.0 + phi, i);
+      circ.rz(theta[k++] / 2.0 - phi, i);
+    }
+    for (uint_t i = 0; i + 1 < num_qubits; i++) {
+      circ.cx(i, i + 1);
+    }
+  }
+}
+
+// same structure with numbers held by Parameter
+static void build_numeric(QuantumCircuit &circ, uint_t num_qubits, uint_t num_layers)
+{
+  Parameter phi(0.25);
+  for (uint_t l = 0; l < num_layers; l++) {
+    for (uint_t i = 0; i < num_qubits; i++) {
+      Parameter theta(0.001 * (l * num_qubits + i));
+      circ.ry(theta * 2.0 + phi, i);
+      circ.rz(theta / 2.0 - phi, i);
+    }
+    for (uint_t i = 0; i + 1 < num_qubits; i++) {
+      circ.cx(i, i + 1);
+    }
+  }
+}
+
+int main(int argc, char **argv)
+{
+  uint_t num_qubits = 100;
+  uint_t num_layers = 100;    // 10000 parameters
+  if (argc > 1)
+    num_qubits = strtoul(argv[1], NULL, 10);
+  if (argc > 2)
+    num_layers = strtoul(argv[2], NULL, 10);
+  uint_t num_params = num_qubits * num_layers;
+
+  std::vector<Parameter> theta;
+  theta.reserve(num_params);
+  for (uint_t k = 0; k < num_params; k++) {
+    theta.push_back(Parameter("theta[" + std::to_string(k) + "]"));
+  }
+  Parameter phi("phi");
+
+  QuantumCircuit symbolic(num_qubits, 0);
+  uint_t before = num_allocations;
+  auto start = std::chrono::steady_clock::now();
+  build_ansatz(symbolic, theta, phi, num_qubits, num_layers);
+  double t_symbolic = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  uint_t a_symbolic = num_allocations - before;
+
+  QuantumCircuit numeric(num_qubits, 0);
+  before = num_allocations;
+  start = std::chrono::steady_clock::now();
+  build_numeric(numeric, num_qubits, num_layers);
+  double t_numeric = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  uint_t a_numeric = num_allocations - before;
+
+  uint_t num_gates = 2 * num_params;
+  std::cout << "parameters : " << symbolic.num_parameters() << ", parameterized gates : " << num_gates << std::endl;
+  std::cout << "allocations are C++ heap allocations (a proxy of QkParam creations, allocations in the C library are not counted)" << std::endl;
+  std::cout << "expressions : " << t_symbolic << " sec, " << a_symbolic << " allocations, " << (double)a_symbolic / num_gates << " per gate" << std::endl;
+  std::cout << "numbers     : " << t_numeric << " sec, " << a_numeric << " allocations, " << (double)a_numeric / num_gates << " per gate" << std::endl;
+  return 0;
+}
@@ -0,0 +1,170 @@
+/*
+# This code is part of Qiskit.
+#
+# (C) Copyright IBM 2026.
+#
+# This code is licensed under the Apache License, Version 2.0. You may
+# obtain a copy of this license in the LICENSE.txt file in the root directory
+# of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# Any modifications or derivative works of this code must retain this
+# copyright notice, and modified files need to carry a notice indicating
+# that they have been altered from the originals.
+*/
+
+// metrics of a circuit updated per instruction
+
+#ifndef __qiskitcpp_circuit_circuit_metrics_hpp__
+#define __qiskitcpp_circuit_circuit_metrics_hpp__
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "utils/types.hpp"
+#include "circuit/library/standard_gates/standard_gate_table.hpp"
+
+#include "qiskit.h"
+
+namespace Qiskit {
+namespace circuit {
+
+/// @class CircuitMetrics
+/// @brief Depth and operation counts of a circuit, updated per instruction.
+/// @details The depth reached on each qubit and clbit (frontier) is kept, so
+///          adding an instruction takes O(number of its operands) and the
+///          metrics are read in O(1). Barriers and operations without
+///          operands (e.g. global phase) do not add depth, as in Qiskit.
+class CircuitMetrics {
+protected:
+    std::vector<uint_t> qubit_depth_;     // frontier depth of each qubit
+    std::vector<uint_t> clbit_depth_;     // frontier depth of each clbit
+    std::vector<uint_t> qubit_depth_2q_;  // frontier depth of each qubit counting multi-qubit operations
+    std::vector<uint_t> clbit_depth_2q_;  // frontier depth of each clbit counting multi-qubit operations
+    uint_t depth_ = 0;
+    uint_t depth_2q_ = 0;
+    uint_t size_ = 0;
+    uint_t num_nonlocal_gates_ = 0;
+    std::vector<uint_t> gate_counts_ = std::vector<uint_t>(num_standard_gates, 0);  // counts of standard gates indexed by QkGate
+    std::map<std::string, uint_t> other_counts_;  // counts of other operations
+public:
+    /// @brief Create new metrics of an empty circuit
+    CircuitMetrics() {}
+
+    /// @brief Add an instruction
+    /// @param kind kind of the operation
+    /// @param name name of the operation
+    /// @param gate table entry of a standard gate, or nullptr for other operations
+    /// @param qubits qubits of the instruction
+    /// @param num_qubits number of qubits
+    /// @param clbits clbits of the instruction
+    /// @param num_clbits number of clbits
+    /// @return layer of the instruction starting from 1, or 0 if the instruction does not add depth
+    uint_t add(const QkOperationKind kind, const char *name, const StandardGateInfo *gate, const std::uint32_t *qubits, const uint_t num_qubits,
+               const std::uint32_t *clbits, const uint_t num_clbits)
+    {
+        if (gate != nullptr) {
+            gate_counts_[(uint_t)gate->gate]++;
+        } else {
+            other_counts_[name]++;
+        }
+        if (kind == QkOperationKind_Barrier || num_qubits + num_clbits == 0) {
+            return 0;
+        }
+        size_++;
+        bool nonlocal = (num_qubits > 1);
+        if (nonlocal) {
+            num_nonlocal_gates_++;
+        }
+
+        uint_t level = 0;
+        uint_t level_2q = 0;
+        for (uint_t i = 0; i < num_qubits; i++) {
+            if (qubits[i] >= qubit_depth_.size()) {
+                qubit_depth_.resize(qubits[i] + 1, 0);
+                qubit_depth_2q_.resize(qubits[i] + 1, 0);
+            }
+            level = std::max(level, qubit_depth_[qubits[i]]);
+            level_2q = std::max(level_2q, qubit_depth_2q_[qubits[i]]);
+        }
+        for (uint_t i = 0; i < num_clbits; i++) {
+            if (clbits[i] >= clbit_depth_.size()) {
+                clbit_depth_.resize(clbits[i] + 1, 0);
+                clbit_depth_2q_.resize(clbits[i] + 1, 0);
+            }
+            level = std::max(level, clbit_depth_[clbits[i]]);
+            level_2q = std::max(level_2q, clbit_depth_2q_[clbits[i]]);
+        }
+        level++;
+        if (nonlocal) {
+            level_2q++;
+        }
+
+        for (uint_t i = 0; i < num_qubits; i++) {
+            qubit_depth_[qubits[i]] = level;
+            qubit_depth_2q_[qubits[i]] = level_2q;
+        }
+        for (uint_t i = 0; i < num_clbits; i++) {
+            clbit_depth_[clbits[i]] = level;
+            clbit_depth_2q_[clbits[i]] = level_2q;
+        }
+        depth_ = std::max(depth_, level);
+        depth_2q_ = std::max(depth_2q_, level_2q);
+        return level;
+    }
+
+    /// @brief Return depth of the circuit
+    /// @return the length of the critical path
+    uint_t depth(void) const
+    {
+        return depth_;
+    }
+
+    /// @brief Return depth of the circuit counting only multi-qubit operations
+    /// @return the number of multi-qubit operations on the critical path
+    uint_t depth_2q(void) const
+    {
+        return depth_2q_;
+    }
+
+    /// @brief Return number of operations adding depth
+    /// @return the number of operations except for barriers and global phase
+    uint_t size(void) const
+    {
+        return size_;
+    }
+
+    /// @brief Return number of operations acting on more than one qubit
+    /// @return the number of non-local operations
+    uint_t num_nonlocal_gates(void) const
+    {
+        return num_nonlocal_gates_;
+    }
+
+    /// @brief Return count of a standard gate
+    /// @param gate QkGate enum
+    /// @return the number of the gate in the circuit
+    uint_t count_ops(const QkGate gate) const
+    {
+        return gate_counts_[(uint_t)gate];
+    }
+
+    /// @brief Return counts of all operations
+    /// @return a map from operation name to count
+    std::map<std::string, uint_t> count_ops(void) const
+    {
+        std::map<std::string, uint_t> counts(other_counts_);
+        for (uint_t i = 0; i < num_standard_gates; i++) {
+            if (gate_counts_[i] > 0) {
+                counts[standard_gate_table[i].name] = gate_counts_[i];
+            }
+        }
+        return counts;
+    }
+};
+
+} // namespace circuit
+} // namespace Qiskit
+
+#endif  // __qiskitcpp_circuit_circuit_metrics_hpp__
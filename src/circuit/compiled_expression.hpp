@@ -0,0 +1,508 @@
+/*
+# This code is part of Qiskit.
+#
+# (C) Copyright IBM 2026.
+#
+# This code is licensed under the Apache License, Version 2.0. You may
+# obtain a copy of this license in the LICENSE.txt file in the root directory
+# of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# Any modifications or derivative works of this code must retain this
+# copyright notice, and modified files need to carry a notice indicating
+# that they have been altered from the originals.
+*/
+
+// parameter expression compiled to bytecode for native evaluation
+
+#ifndef __qiskitcpp_circuit_compiled_expression_hpp__
+#define __qiskitcpp_circuit_compiled_expression_hpp__
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "utils/types.hpp"
+#include "circuit/parameter.hpp"
+
+namespace Qiskit {
+namespace circuit {
+
+/// @class CompiledExpression
+/// @brief A real valued Parameter expression compiled to stack bytecode.
+/// @details The string form of the expression is parsed once and each symbol
+///          is replaced by a slot in an array of values, so evaluation does
+///          not call the C-API. Sub-expressions of numbers are folded.
+///          Expressions with complex numbers can not be compiled.
+class CompiledExpression {
+public:
+    enum OpCode : std::uint8_t {
+        CONST, SYMBOL, NEG, ADD, SUB, MUL, DIV, POW,
+        EXP, LOG, ABS, SIN, COS, TAN, ASIN, ACOS, ATAN, SIGN, CONJ
+    };
+
+    struct Code {
+        OpCode op;
+        uint_t slot;        // index of value for SYMBOL
+        double value;       // value for CONST
+    };
+protected:
+    std::vector<Code> code_;
+    std::vector<std::string> symbols_;
+    uint_t num_slots_ = 0;
+    uint_t max_depth_ = 0;
+    bool valid_ = false;
+
+    static const uint_t block_size = 64;    // number of sets evaluated together
+public:
+    /// @brief Create an empty (invalid) expression
+    CompiledExpression() {}
+
+    /// @brief Compile a Parameter
+    /// @details Symbols are assigned to slots in the circuit parameter order
+    ///          (see Parameter::symbol_less).
+    /// @param expr a Parameter expression
+    CompiledExpression(const Parameter &expr)
+    {
+        std::vector<std::string> names = expr.symbols();
+        std::sort(names.begin(), names.end(), Parameter::symbol_less);
+        compile(expr.as_str(), names);
+    }
+
+    /// @brief Compile a Parameter with given symbol slots
+    /// @param expr a Parameter expression
+    /// @param symbols names of symbols, slot i is the value of symbols[i]
+    CompiledExpression(const Parameter &expr, const std::vector<std::string> &symbols)
+    {
+        compile(expr.as_str(), symbols);
+    }
+
+    /// @brief Compile a string expression
+    /// @param expr a string expression of a Parameter
+    /// @param symbols names of symbols, slot i is the value of symbols[i]
+    /// @return true if the expression is compiled
+    bool compile(const std::string &expr, const std::vector<std::string> &symbols)
+    {
+        std::unordered_map<std::string, uint_t> slots;
+        for (uint_t i = 0; i < symbols.size(); i++) {
+            slots[symbols[i]] = i;
+        }
+        return compile(expr.c_str(), slots, symbols.size());
+    }
+
+    /// @brief Compile a string expression
+    /// @param expr a string expression of a Parameter
+    /// @param slots map from symbol name to slot
+    /// @param num_slots number of slots in a set of values
+    /// @return true if the expression is compiled
+    bool compile(const char *expr, const std::unordered_map<std::string, uint_t> &slots, const uint_t num_slots)
+    {
+        code_.clear();
+        symbols_.clear();
+        num_slots_ = num_slots;
+        max_depth_ = 0;
+        Parser parser = {expr, &slots, this};
+        valid_ = parser.parse_sum();
+        parser.skip_space();
+        valid_ &= (*parser.p == '\0');
+        if (valid_) {
+            uint_t depth = 0;
+            for (auto &c : code_) {
+                if (c.op == CONST || c.op == SYMBOL) {
+                    max_depth_ = std::max(max_depth_, ++depth);
+                } else if (c.op >= ADD && c.op <= POW) {
+                    depth--;
+                }
+            }
+        } else {
+            code_.clear();
+            symbols_.clear();
+        }
+        return valid_;
+    }
+
+    /// @brief Return if the expression is compiled
+    /// @return true if the expression can be evaluated
+    bool is_valid(void) const
+    {
+        return valid_;
+    }
+
+    /// @brief Return if the expression has no symbols
+    /// @return true if the expression is a number
+    bool is_constant(void) const
+    {
+        return valid_ && code_.size() == 1 && code_[0].op == CONST;
+    }
+
+    /// @brief Return names of symbols in the expression
+    /// @return a list of names in order of appearance
+    const std::vector<std::string> &symbols(void) const
+    {
+        return symbols_;
+    }
+
+    /// @brief Return the number of slots in a set of values
+    /// @return the number of slots
+    uint_t num_slots(void) const
+    {
+        return num_slots_;
+    }
+
+    /// @brief Return the bytecode
+    /// @return a list of operations in postfix order
+    const std::vector<Code> &code(void) const
+    {
+        return code_;
+    }
+
+    /// @brief Evaluate the expression
+    /// @param values values of slots
+    /// @return the value of the expression (NaN if the expression is not compiled)
+    double evaluate(const double *values) const
+    {
+        if (!valid_) {
+            return std::nan("");
+        }
+        double small[16];
+        std::vector<double> large;
+        double *stack = small;
+        if (max_depth_ > 16) {
+            large.resize(max_depth_);
+            stack = large.data();
+        }
+        uint_t top = 0;
+        for (auto &c : code_) {
+            switch (c.op) {
+            case CONST:
+                stack[top++] = c.value;
+                break;
+            case SYMBOL:
+                stack[top++] = values[c.slot];
+                break;
+            case ADD: case SUB: case MUL: case DIV: case POW:
+                top--;
+                stack[top - 1] = apply(c.op, stack[top - 1], stack[top]);
+                break;
+            default:
+                stack[top - 1] = apply(c.op, stack[top - 1], 0.0);
+                break;
+            }
+        }
+        return stack[0];
+    }
+
+    /// @brief Evaluate the expression for many sets of values
+    /// @details Each operation is applied to a block of sets at once, so the
+    ///          inner loops are vectorized by the compiler.
+    /// @param values num_sets sets of values, set i starts at values + i * stride
+    /// @param num_sets the number of sets
+    /// @param stride distance between sets
+    /// @param out an array of num_sets results
+    void evaluate(const double *values, const uint_t num_sets, const uint_t stride, double *out) const
+    {
+        if (!valid_) {
+            std::fill(out, out + num_sets, std::nan(""));
+            return;
+        }
+        std::vector<double> stack(max_depth_ * block_size);
+        for (uint_t begin = 0; begin < num_sets; begin += block_size) {
+            uint_t n = (num_sets - begin < block_size) ? num_sets - begin : block_size;
+            double *top = stack.data();     // next free row of the stack
+            for (auto &c : code_) {
+                double *b = (top == stack.data()) ? top : top - block_size;   // top row
+                double *a = (b == stack.data()) ? b : b - block_size;           // second row
+                switch (c.op) {
+                case CONST:
+                    std::fill(top, top + n, c.value);
+                    top += block_size;
+                    break;
+                case SYMBOL:
+                {
+                    const double *v = values + begin * stride + c.slot;
+                    for (uint_t i = 0; i < n; i++) {
+                        top[i] = v[i * stride];
+                    }
+                    top += block_size;
+                    break;
+                }
+                case ADD:
+                    for (uint_t i = 0; i < n; i++) {
+                        a[i] += b[i];
+                    }
+                    top = b;
+                    break;
+                case SUB:
+                    for (uint_t i = 0; i < n; i++) {
+                        a[i] -= b[i];
+                    }
+                    top = b;
+                    break;
+                case MUL:
+                    for (uint_t i = 0; i < n; i++) {
+                        a[i] *= b[i];
+                    }
+                    top = b;
+                    break;
+                case DIV:
+                    for (uint_t i = 0; i < n; i++) {
+                        a[i] /= b[i];
+                    }
+                    top = b;
+                    break;
+                case POW:
+                    for (uint_t i = 0; i < n; i++) {
+                        a[i] = std::pow(a[i], b[i]);
+                    }
+                    top = b;
+                    break;
+                case NEG:
+                    for (uint_t i = 0; i < n; i++) {
+                        b[i] = -b[i];
+                    }
+                    break;
+                default:
+                    for (uint_t i = 0; i < n; i++) {
+                        b[i] = apply(c.op, b[i], 0.0);
+                    }
+                    break;
+                }
+            }
+            std::copy(stack.data(), stack.data() + n, out + begin);
+        }
+    }
+
+    /// @brief Apply an operation
+    /// @param op operation other than CONST and SYMBOL
+    /// @param a the first operand
+    /// @param b the second operand of binary operations
+    /// @return the result
+    static double apply(const OpCode op, const double a, const double b)
+    {
+        switch (op) {
+        case NEG:  return -a;
+        case ADD:  return a + b;
+        case SUB:  return a - b;
+        case MUL:  return a * b;
+        case DIV:  return a / b;
+        case POW:  return std::pow(a, b);
+        case EXP:  return std::exp(a);
+        case LOG:  return std::log(a);
+        case ABS:  return std::fabs(a);
+        case SIN:  return std::sin(a);
+        case COS:  return std::cos(a);
+        case TAN:  return std::tan(a);
+        case ASIN: return std::asin(a);
+        case ACOS: return std::acos(a);
+        case ATAN: return std::atan(a);
+        case SIGN: return (double)((a > 0.0) - (a < 0.0));
+        case CONJ: return a;
+        default:   return std::nan("");
+        }
+    }
+protected:
+    // append an operation folding operands of numbers
+    void emit(const OpCode op)
+    {
+        uint_t n = (op >= ADD && op <= POW) ? 2 : 1;
+        if (code_.size() >= n && code_.back().op == CONST && (n == 1 || code_[code_.size() - 2].op == CONST)) {
+            double b = code_.back().value;
+            if (n == 2) {
+                code_.pop_back();
+                code_.back().value = apply(op, code_.back().value, b);
+            } else {
+                code_.back().value = apply(op, b, 0.0);
+            }
+            return;
+        }
+        Code c = {op, 0, 0.0};
+        code_.push_back(c);
+    }
+
+    // recursive descent parser of expressions in the Python syntax
+    struct Parser {
+        const char *p;
+        const std::unordered_map<std::string, uint_t> *slots;
+        CompiledExpression *out;
+
+        void skip_space(void)
+        {
+            while (*p == ' ' || *p == '\t') {
+                p++;
+            }
+        }
+
+        // sum := product (('+' | '-') product)*
+        bool parse_sum(void)
+        {
+            if (!parse_product()) {
+                return false;
+            }
+            for (;;) {
+                skip_space();
+                char c = *p;
+                if (c != '+' && c != '-') {
+                    return true;
+                }
+                p++;
+                if (!parse_product()) {
+                    return false;
+                }
+                out->emit(c == '+' ? ADD : SUB);
+            }
+        }
+
+        // product := unary (('*' | '/') unary)*
+        bool parse_product(void)
+        {
+            if (!parse_unary()) {
+                return false;
+            }
+            for (;;) {
+                skip_space();
+                char c = *p;
+                if ((c != '*' && c != '/') || p[1] == '*') {
+                    return true;
+                }
+                p++;
+                if (!parse_unary()) {
+                    return false;
+                }
+                out->emit(c == '*' ? MUL : DIV);
+            }
+        }
+
+        // unary := ('-' | '+') unary | power
+        bool parse_unary(void)
+        {
+            skip_space();
+            if (*p == '-') {
+                p++;
+                if (!parse_unary()) {
+                    return false;
+                }
+                out->emit(NEG);
+                return true;
+            }
+            if (*p == '+') {
+                p++;
+                return parse_unary();
+            }
+            return parse_power();
+        }
+
+        // power := primary ('**' unary)?
+        bool parse_power(void)
+        {
+            if (!parse_primary()) {
+                return false;
+            }
+            skip_space();
+            if (p[0] == '*' && p[1] == '*') {
+                p += 2;
+                if (!parse_unary()) {
+                    return false;
+                }
+                out->emit(POW);
+            }
+            return true;
+        }
+
+        // primary := number | symbol | function '(' sum ')' | '(' sum ')'
+        bool parse_primary(void)
+        {
+            skip_space();
+            unsigned char c = (unsigned char)*p;
+            if (c == '(') {
+                p++;
+                if (!parse_sum()) {
+                    return false;
+                }
+                skip_space();
+                if (*p != ')') {
+                    return false;
+                }
+                p++;
+                return true;
+            }
+            if (std::isdigit(c) || c == '.') {
+                char *end;
+                double v = std::strtod(p, &end);
+                if (end == p || *end == 'i' || *end == 'j' || *end == 'I') {
+                    // imaginary numbers are not supported
+                    return false;
+                }
+                p = end;
+                Code code = {CONST, 0, v};
+                out->code_.push_back(code);
+                return true;
+            }
+            if (std::isalpha(c) || c == '_' || c >= 0x80) {
+                const char *begin = p;
+                while (std::isalnum((unsigned char)*p) || *p == '_' || (unsigned char)*p >= 0x80) {
+                    p++;
+                }
+                if (*p == '[') {
+                    while (*p != '\0' && *p != ']') {
+                        p++;
+                    }
+                    if (*p == ']') {
+                        p++;
+                    }
+                }
+                std::string name(begin, p - begin);
+                if (*p == '(') {
+                    OpCode op;
+                    if (!function(name, op)) {
+                        return false;
+                    }
+                    p++;
+                    if (!parse_sum()) {
+                        return false;
+                    }
+                    skip_space();
+                    if (*p != ')') {
+                        return false;
+                    }
+                    p++;
+                    out->emit(op);
+                    return true;
+                }
+                auto slot = slots->find(name);
+                if (slot == slots->end()) {
+                    return false;
+                }
+                Code code = {SYMBOL, slot->second, 0.0};
+                out->code_.push_back(code);
+                if (std::find(out->symbols_.begin(), out->symbols_.end(), name) == out->symbols_.end()) {
+                    out->symbols_.push_back(name);
+                }
+                return true;
+            }
+            return false;
+        }
+
+        static bool function(const std::string &name, OpCode &op)
+        {
+            static const std::pair<const char *, OpCode> functions[] = {
+                {"exp", EXP}, {"log", LOG}, {"abs", ABS}, {"sin", SIN}, {"cos", COS}, {"tan", TAN},
+                {"asin", ASIN}, {"acos", ACOS}, {"atan", ATAN}, {"sign", SIGN}, {"conj", CONJ}};
+            for (auto &f : functions) {
+                if (name == f.first) {
+                    op = f.second;
+                    return true;
+                }
+            }
+            return false;
+        }
+    };
+};
+
+} // namespace circuit
+} // namespace Qiskit
+
+#endif  // __qiskitcpp_circuit_compiled_expression_hpp__
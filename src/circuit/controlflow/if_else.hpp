@@ -34,10 +34,12 @@ protected:
   bool test_else_ = false;
 public:
   /// @brief Create a new IfElseOp circuit operator
+  /// @details Bodies are new empty circuits with the registers of circ,
+  ///          so gates added to a body are not added to circ.
   /// @param (circ)
   /// @param (clbit)
   /// @param (value)
-  IfElseOp(const QuantumCircuit& circ, uint32_t clbit, uint32_t value) : ControlFlowOp(clbit, value), true_body_(circ), false_body_(circ) {}
+  IfElseOp(const QuantumCircuit& circ, uint32_t clbit, uint32_t value) : ControlFlowOp(clbit, value), true_body_(circ.copy_empty_like()), false_body_(circ.copy_empty_like()) {}
 
   /// @brief Return true body available in this operator
   /// @return true body
@@ -57,6 +59,7 @@ public:
 
   void add_control_flow_op(QuantumCircuit& circ) override
   {
+    std::cerr << " IfElseOp Warning : control flow is not supported by the C-API, the body is not added to the circuit" << std::endl;
     if(test_else_){
       // if_else
       std::shared_ptr<rust_circuit> true_circ = true_body_.get_rust_circuit();
@@ -61,6 +61,19 @@ public:
         num_clbits_ = num_clbits;
     }
 
+    /// @brief Create a new standard gate instruction
+    /// @param name The name of the instruction
+    /// @param num_qubits The number of qubits in the instruction
+    /// @param gate QkGate enum for Qiskit C-API
+    Instruction(const std::string& name, uint_t num_qubits, QkGate gate)
+    {
+        name_ = name;
+        num_qubits_ = num_qubits;
+        num_clbits_ = 0;
+        map_ = gate;
+        is_standard_gate_ = true;
+    }
+
     /// @brief Create a new instruction
     /// @param other The instruction to be copoed
     Instruction(const Instruction& other)
@@ -0,0 +1,271 @@
+/*
+# This code is part of Qiskit.
+#
+# (C) Copyright IBM 2026.
+#
+# This code is licensed under the Apache License, Version 2.0. You may
+# obtain a copy of this license in the LICENSE.txt file in the root directory
+# of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# Any modifications or derivative works of this code must retain this
+# copyright notice, and modified files need to carry a notice indicating
+# that they have been altered from the originals.
+*/
+
+// allocation-free iteration over instructions of a Qiskit circuit
+
+#ifndef __qiskitcpp_circuit_instruction_view_hpp__
+#define __qiskitcpp_circuit_instruction_view_hpp__
+
+#include "utils/types.hpp"
+#include "utils/array_view.hpp"
+#include "circuit/library/standard_gates/standard_gate_table.hpp"
+
+#include "qiskit.h"
+
+namespace Qiskit {
+namespace circuit {
+
+class InstructionIterator;
+
+/// @class InstructionView
+/// @brief A lightweight view of an instruction in a circuit.
+/// @details A view refers to the buffer owned by the iterator that produced it,
+///          and it is valid until the iterator is advanced or destroyed.
+///          Copy the data (e.g. ArrayView::to_vector) to keep it longer.
+class InstructionView {
+protected:
+    const InstructionIterator *it_;
+public:
+    /// @brief Create a new view
+    /// @param it the iterator owning the instruction buffer
+    InstructionView(const InstructionIterator *it) : it_(it) {}
+
+    /// @brief Return index of the instruction in the circuit
+    /// @return index of the instruction
+    uint_t index(void) const;
+
+    /// @brief Return kind of the operation
+    /// @return QkOperationKind of the operation
+    QkOperationKind kind(void) const;
+
+    /// @brief Return name of the operation
+    /// @return name of the operation
+    const char *name(void) const;
+
+    /// @brief Return table entry of the standard gate
+    /// @return pointer to the table entry, or nullptr if this is not a standard gate
+    const StandardGateInfo *gate_info(void) const;
+
+    /// @brief check if this instruction is a standard gate
+    /// @return true if the instruction is a standard gate
+    bool is_standard_gate(void) const
+    {
+        return gate_info() != nullptr;
+    }
+
+    /// @brief Return gate enum for Qiskit C-API (valid only for standard gates)
+    /// @return QkGate enum
+    QkGate gate(void) const
+    {
+        return gate_info()->gate;
+    }
+
+    /// @brief Return qubits of the instruction
+    /// @return view of qubits
+    ArrayView<uint32_t> qubits(void) const;
+
+    /// @brief Return clbits of the instruction
+    /// @return view of clbits
+    ArrayView<uint32_t> clbits(void) const;
+
+    /// @brief Return parameters of the instruction
+    /// @return view of parameters
+    ArrayView<QkParam *> params(void) const;
+
+    /// @brief Return the underlying C-API instruction
+    /// @return reference to QkCircuitInstruction
+    const QkCircuitInstruction &instruction(void) const;
+};
+
+/// @class InstructionIterator
+/// @brief An input iterator over instructions of a circuit.
+/// @details The iterator owns a single QkCircuitInstruction that is reused for
+///          every instruction, and it is only filled when the view asks for
+///          more than the kind of the operation.
+class InstructionIterator {
+protected:
+    const QkCircuit *circ_;
+    uint_t index_;
+    mutable QkCircuitInstruction inst_;
+    mutable bool loaded_ = false;
+    mutable QkOperationKind kind_;
+    mutable bool kind_loaded_ = false;
+
+    void release(void) const
+    {
+        if (loaded_) {
+            qk_circuit_instruction_clear(&inst_);
+            loaded_ = false;
+        }
+        kind_loaded_ = false;
+    }
+public:
+    /// @brief Create a new iterator
+    /// @param circ a circuit
+    /// @param index index of the first instruction
+    InstructionIterator(const QkCircuit *circ, const uint_t index) : circ_(circ), index_(index) {}
+
+    /// @brief Create a new iterator (the instruction buffer is not shared)
+    /// @param other an iterator to be copied
+    InstructionIterator(const InstructionIterator &other) : circ_(other.circ_), index_(other.index_) {}
+
+    ~InstructionIterator()
+    {
+        release();
+    }
+
+    InstructionIterator &operator=(const InstructionIterator &other)
+    {
+        if (this != &other) {
+            release();
+            circ_ = other.circ_;
+            index_ = other.index_;
+        }
+        return *this;
+    }
+
+    /// @brief Return index of the current instruction
+    /// @return index of the instruction
+    uint_t index(void) const
+    {
+        return index_;
+    }
+
+    /// @brief Return kind of the current operation
+    /// @return QkOperationKind of the operation
+    QkOperationKind kind(void) const
+    {
+        if (!kind_loaded_) {
+            kind_ = qk_circuit_instruction_kind(circ_, index_);
+            kind_loaded_ = true;
+        }
+        return kind_;
+    }
+
+    /// @brief Return the current instruction
+    /// @return reference to the reused QkCircuitInstruction
+    const QkCircuitInstruction &instruction(void) const
+    {
+        if (!loaded_) {
+            qk_circuit_get_instruction(circ_, index_, &inst_);
+            loaded_ = true;
+        }
+        return inst_;
+    }
+
+    InstructionView operator*(void) const
+    {
+        return InstructionView(this);
+    }
+
+    InstructionIterator &operator++(void)
+    {
+        release();
+        index_++;
+        return *this;
+    }
+
+    bool operator==(const InstructionIterator &other) const
+    {
+        return circ_ == other.circ_ && index_ == other.index_;
+    }
+
+    bool operator!=(const InstructionIterator &other) const
+    {
+        return !(*this == other);
+    }
+};
+
+/// @class InstructionRange
+/// @brief A range of instructions in a circuit to be used in range-based for
+class InstructionRange {
+protected:
+    const QkCircuit *circ_;
+    uint_t size_;
+public:
+    /// @brief Create a new range
+    /// @param circ a circuit
+    InstructionRange(const QkCircuit *circ) : circ_(circ)
+    {
+        size_ = qk_circuit_num_instructions(circ);
+    }
+
+    /// @brief Return number of instructions in the range
+    /// @return number of instructions
+    uint_t size(void) const
+    {
+        return size_;
+    }
+
+    InstructionIterator begin(void) const
+    {
+        return InstructionIterator(circ_, 0);
+    }
+
+    InstructionIterator end(void) const
+    {
+        return InstructionIterator(circ_, size_);
+    }
+};
+
+inline uint_t InstructionView::index(void) const
+{
+    return it_->index();
+}
+
+inline QkOperationKind InstructionView::kind(void) const
+{
+    return it_->kind();
+}
+
+inline const char *InstructionView::name(void) const
+{
+    return it_->instruction().name;
+}
+
+inline const StandardGateInfo *InstructionView::gate_info(void) const
+{
+    if (kind() != QkOperationKind_Gate) {
+        return nullptr;
+    }
+    return find_standard_gate(name());
+}
+
+inline ArrayView<uint32_t> InstructionView::qubits(void) const
+{
+    const QkCircuitInstruction &inst = it_->instruction();
+    return ArrayView<uint32_t>(inst.qubits, inst.num_qubits);
+}
+
+inline ArrayView<uint32_t> InstructionView::clbits(void) const
+{
+    const QkCircuitInstruction &inst = it_->instruction();
+    return ArrayView<uint32_t>(inst.clbits, inst.num_clbits);
+}
+
+inline ArrayView<QkParam *> InstructionView::params(void) const
+{
+    const QkCircuitInstruction &inst = it_->instruction();
+    return ArrayView<QkParam *>(inst.params, inst.num_params);
+}
+
+inline const QkCircuitInstruction &InstructionView::instruction(void) const
+{
+    return it_->instruction();
+}
+
+} // namespace circuit
+} // namespace Qiskit
+
+#endif  // __qiskitcpp_circuit_instruction_view_hpp__
@@ -0,0 +1,174 @@
+/*
+# This code is part of Qiskit.
+#
+# (C) Copyright IBM 2026.
+#
+# This code is licensed under the Apache License, Version 2.0. You may
+# obtain a copy of this license in the LICENSE.txt file in the root directory
+# of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# Any modifications or derivative works of this code must retain this
+# copyright notice, and modified files need to carry a notice indicating
+# that they have been altered from the originals.
+*/
+
+// compile-time table of standard gates
+
+#ifndef __qiskitcpp_circuit_library_standard_gate_table_hpp__
+#define __qiskitcpp_circuit_library_standard_gate_table_hpp__
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include "utils/types.hpp"
+#include "qiskit.h"
+
+namespace Qiskit {
+namespace circuit {
+
+/// @struct StandardGateInfo
+/// @brief Static properties of a standard gate
+struct StandardGateInfo {
+    const char *name;       // gate name used in Qiskit
+    const char *qasm_name;  // gate name used in OpenQASM 3
+    QkGate gate;            // QkGate enum for Qiskit C-API
+    std::uint32_t num_qubits;
+    std::uint32_t num_params;
+};
+
+/// @brief number of standard gates
+constexpr uint_t num_standard_gates = 52;
+
+/// @brief table of standard gates, indexed by QkGate
+constexpr StandardGateInfo standard_gate_table[num_standard_gates] = {
+    {"global_phase", "global_phase", QkGate_GlobalPhase, 0, 1},
+    {"h", "h", QkGate_H, 1, 0},
+    {"id", "id", QkGate_I, 1, 0},
+    {"x", "x", QkGate_X, 1, 0},
+    {"y", "y", QkGate_Y, 1, 0},
+    {"z", "z", QkGate_Z, 1, 0},
+    {"p", "p", QkGate_Phase, 1, 1},
+    {"r", "r", QkGate_R, 1, 2},
+    {"rx", "rx", QkGate_RX, 1, 1},
+    {"ry", "ry", QkGate_RY, 1, 1},
+    {"rz", "rz", QkGate_RZ, 1, 1},
+    {"s", "s", QkGate_S, 1, 0},
+    {"sdg", "sdg", QkGate_Sdg, 1, 0},
+    {"sx", "sx", QkGate_SX, 1, 0},
+    {"sxdg", "sxdg", QkGate_SXdg, 1, 0},
+    {"t", "t", QkGate_T, 1, 0},
+    {"tdg", "tdg", QkGate_Tdg, 1, 0},
+    {"u", "U", QkGate_U, 1, 3},
+    {"u1", "u1", QkGate_U1, 1, 1},
+    {"u2", "u2", QkGate_U2, 1, 2},
+    {"u3", "u3", QkGate_U3, 1, 3},
+    {"ch", "ch", QkGate_CH, 2, 0},
+    {"cx", "cx", QkGate_CX, 2, 0},
+    {"cy", "cy", QkGate_CY, 2, 0},
+    {"cz", "cz", QkGate_CZ, 2, 0},
+    {"dcx", "dcx", QkGate_DCX, 2, 0},
+    {"ecr", "ecr", QkGate_ECR, 2, 0},
+    {"swap", "swap", QkGate_Swap, 2, 0},
+    {"iswap", "iswap", QkGate_ISwap, 2, 0},
+    {"cp", "cp", QkGate_CPhase, 2, 1},
+    {"crx", "crx", QkGate_CRX, 2, 1},
+    {"cry", "cry", QkGate_CRY, 2, 1},
+    {"crz", "crz", QkGate_CRZ, 2, 1},
+    {"cs", "cs", QkGate_CS, 2, 0},
+    {"csdg", "csdg", QkGate_CSdg, 2, 0},
+    {"csx", "csx", QkGate_CSX, 2, 0},
+    {"cu", "cu", QkGate_CU, 2, 4},
+    {"cu1", "cu1", QkGate_CU1, 2, 1},
+    {"cu3", "cu3", QkGate_CU3, 2, 3},
+    {"rxx", "rxx", QkGate_RXX, 2, 1},
+    {"ryy", "ryy", QkGate_RYY, 2, 1},
+    {"rzz", "rzz", QkGate_RZZ, 2, 1},
+    {"rzx", "rzx", QkGate_RZX, 2, 1},
+    {"xx_minus_yy", "xx_minus_yy", QkGate_XXMinusYY, 2, 2},
+    {"xx_plus_yy", "xx_plus_yy", QkGate_XXPlusYY, 2, 2},
+    {"ccx", "ccx", QkGate_CCX, 3, 0},
+    {"ccz", "ccz", QkGate_CCZ, 3, 0},
+    {"cswap", "cswap", QkGate_CSwap, 3, 0},
+    {"rccx", "rccx", QkGate_RCCX, 3, 0},
+    {"mcx", "mcx", QkGate_C3X, 4, 0},
+    {"c3sx", "c3sx", QkGate_C3SX, 4, 0},
+    {"rcccx", "rcccx", QkGate_RC3X, 4, 0},
+};
+
+/// @brief seed of the perfect hash for standard gate names
+constexpr std::uint32_t standard_gate_hash_seed = 85;
+
+/// @brief Hash a gate name (FNV-1a with standard_gate_hash_seed as offset basis)
+/// @param name null terminated gate name
+/// @param h hash value accumulated so far
+/// @return hash value
+constexpr std::uint32_t standard_gate_hash(const char *name, std::uint32_t h = standard_gate_hash_seed)
+{
+    return *name == '\0' ? h : standard_gate_hash(name + 1, (h ^ (std::uint32_t)(unsigned char)*name) * 16777619u);
+}
+
+/// @brief slots of the perfect hash: index into standard_gate_table, 255 for empty slot
+/// (generated with standard_gate_hash_seed, verified at compile time below)
+constexpr std::uint8_t standard_gate_hash_slots[256] = {
+    255,  35, 255, 255, 255, 255, 255,   1, 255, 255, 255, 255, 255,  39,  22, 255,
+    255, 255, 255, 255,   9,  41,  19, 255,  50, 255, 255, 255, 255, 255,  32, 255,
+    255,  26, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+      2, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,   6,
+    255, 255, 255, 255,   4, 255, 255, 255,  51, 255, 255,  49, 255, 255, 255, 255,
+    255, 255, 255, 255, 255,  36, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+     17,  48, 255, 255, 255,   7, 255, 255, 255, 255, 255,  46,  37, 255, 255, 255,
+    255,  44, 255, 255, 255, 255,  29, 255, 255, 255, 255, 255, 255, 255, 255,  12,
+    255, 255, 255,  18, 255, 255, 255, 255, 255, 255, 255,  31, 255, 255, 255, 255,
+    255,  45,  38, 255, 255, 255,  16,  40, 255, 255, 255, 255, 255, 255,  13,  28,
+    255,  23, 255, 255, 255, 255, 255,   8,  25,  20, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,  27, 255,
+    255, 255, 255, 255, 255, 255,  34, 255, 255, 255, 255,  14, 255,  10, 255, 255,
+    255, 255,  11, 255, 255, 255, 255,   3, 255,  43, 255, 255, 255, 255,  21, 255,
+    255, 255, 255,  33, 255, 255, 255, 255,  24, 255, 255, 255, 255, 255, 255,  42,
+    255, 255, 255,  15, 255,  47, 255, 255,  30, 255, 255, 255, 255,   5,   0, 255,
+};
+
+/// @brief check that the table is ordered by QkGate and every name hashes to its own slot
+constexpr bool standard_gate_table_is_valid(uint_t i = 0)
+{
+    return i == num_standard_gates ? true :
+        ((uint_t)standard_gate_table[i].gate == i &&
+         standard_gate_hash_slots[standard_gate_hash(standard_gate_table[i].name) & 255] == i &&
+         standard_gate_table_is_valid(i + 1));
+}
+
+static_assert(standard_gate_table_is_valid(), "standard_gate_table must be ordered by QkGate and standard_gate_hash_slots must be regenerated when a name changes");
+
+/// @brief Return static properties of a standard gate
+/// @param gate QkGate enum
+/// @return reference to the table entry
+inline const StandardGateInfo& standard_gate_info(QkGate gate)
+{
+    return standard_gate_table[(uint_t)gate];
+}
+
+/// @brief Find a standard gate by name
+/// @param name gate name
+/// @return pointer to the table entry, or nullptr if name is not a standard gate
+inline const StandardGateInfo* find_standard_gate(const char *name)
+{
+    std::uint8_t slot = standard_gate_hash_slots[standard_gate_hash(name) & 255];
+    if (slot == 255 || std::strcmp(standard_gate_table[slot].name, name) != 0) {
+        return nullptr;
+    }
+    return &standard_gate_table[slot];
+}
+
+/// @brief Find a standard gate by name
+/// @param name gate name
+/// @return pointer to the table entry, or nullptr if name is not a standard gate
+inline const StandardGateInfo* find_standard_gate(const std::string &name)
+{
+    return find_standard_gate(name.c_str());
+}
+
+} // namespace circuit
+} // namespace Qiskit
+
+#endif  //__qiskitcpp_circuit_library_standard_gate_table_hpp__
@@ -19,6 +19,7 @@
 
 #include <unordered_map>
 
+#include "circuit/library/standard_gates/standard_gate_table.hpp"
 #include "circuit/library/standard_gates/dcx.hpp"
 #include "circuit/library/standard_gates/ecr.hpp"
 #include "circuit/library/standard_gates/global_phase.hpp"
@@ -51,6 +52,18 @@
 namespace Qiskit {
 namespace circuit {
 
+/// @brief Create an instruction for a standard gate from the gate table
+/// @param info table entry of the gate
+/// @return the instruction
+inline Instruction standard_gate_instruction(const StandardGateInfo& info)
+{
+    return Instruction(info.name, info.num_qubits, info.gate);
+}
+
+/// @brief Return a mapping of gate names and standard gate objects
+/// @details This builds a new map on every call. Use find_standard_gate
+///          or standard_gate_info for lookups.
+/// @return mapping of gate names and instructions
 inline std::unordered_map<std::string, Instruction> get_standard_gate_name_mapping(void)
 {
     // mapping of gate string and QkGate
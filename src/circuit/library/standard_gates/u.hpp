@@ -69,7 +69,7 @@ public:
     /// @return number of parameters
     uint_t num_params(void) const override
     {
-        return 3;
+        return 4;
     }
 };
 
@@ -19,6 +19,13 @@
 
 #include <memory>
 #include <complex>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <utility>
 
 #include "utils/types.hpp"
 #include "qiskit.h"
@@ -30,44 +37,43 @@ namespace Qiskit
 namespace circuit
 {
 
+/// @class Parameter
+/// @brief A number or a symbolic expression used as a gate parameter.
+/// @details A number is held inline and arithmetic between numbers is done
+///          natively. A QkParam is allocated only when the Parameter becomes
+///          symbolic or is passed to the C-API.
 class Parameter
 {
     friend class QuantumCircuit;
 protected:
-    std::shared_ptr<qiskit_param> qiskit_param_ = nullptr;
+    mutable std::shared_ptr<qiskit_param> qiskit_param_ = nullptr;     // symbolic expression, or a cache of the number
+    std::complex<double> value_ = 0.0;      // value of a number
+    bool numeric_ = true;
+
+    typedef QkExitCode (*unary_op)(qiskit_param *, const qiskit_param *);
+    typedef QkExitCode (*binary_op)(qiskit_param *, const qiskit_param *, const qiskit_param *);
 public:
     /// @brief Create a new Parameter
-    Parameter()
-    {
-        qiskit_param_ = std::shared_ptr<qiskit_param>(qk_param_zero(), qk_param_free);
-    }
+    Parameter() {}
 
     /// @brief Create a new Parameter with v
     /// @param v floating point value to initialize the Parameter
-    Parameter(double v)
-    {
-        qiskit_param_ = std::shared_ptr<qiskit_param>(qk_param_from_double(v), qk_param_free);
-    }
+    Parameter(double v) : value_(v) {}
 
     /// @brief Create a new Parameter with v
     /// @param v floating point value to initialize the Parameter
-    Parameter(std::complex<double> v)
-    {
-        qiskit_param_ = std::shared_ptr<qiskit_param>(qk_param_from_complex(qk_complex64_from_native(&v)), qk_param_free);
-    }
+    Parameter(std::complex<double> v) : value_(v) {}
 
     /// @brief Create a new Parameter with v
     /// @param v integer value to initialize the Parameter
-    Parameter(int_t v)
-    {
-        qiskit_param_ = std::shared_ptr<qiskit_param>(qk_param_from_double((double)v), qk_param_free);
-    }
+    Parameter(int_t v) : value_((double)v) {}
 
     /// @brief Create a new symbol
     /// @param name a name of symbol
     Parameter(std::string name)
     {
         qiskit_param_ = std::shared_ptr<qiskit_param>(qk_param_new_symbol((char *)name.c_str()), qk_param_free);
+        numeric_ = false;
     }
 
     /// @brief Create a new Parameter from other Parameter
@@ -76,6 +82,15 @@ public:
     {
         // copying reference
         qiskit_param_ = prm.qiskit_param_;
+        value_ = prm.value_;
+        numeric_ = prm.numeric_;
+    }
+
+    /// @brief Create a new Parameter moving other Parameter
+    /// @param prm source Parameter, left as zero
+    Parameter(Parameter &&prm)
+    {
+        replace(std::move(prm));
     }
 
     /// @brief Create a new Parameter from QkParam
@@ -83,6 +98,7 @@ public:
     Parameter(qiskit_param* prm)
     {
         qiskit_param_ = std::shared_ptr<qiskit_param>(prm, qk_param_free);
+        numeric_ = false;
     }
 
     ~Parameter()
@@ -91,11 +107,25 @@ public:
             qiskit_param_.reset();
     }
 
+    /// @brief Return if the Parameter is a number held without QkParam
+    /// @return true if the Parameter is a number
+    bool is_numeric(void) const
+    {
+        return numeric_;
+    }
+
+    /// @brief Return if the Parameter is a real number held without QkParam
+    /// @return true if the Parameter is a real number
+    bool is_real(void) const
+    {
+        return numeric_ && value_.imag() == 0.0;
+    }
+
     /// @brief get string expression of the Parameter
 	/// @return a string expression of the Parameter
     std::string as_str(void) const
     {
-        char* str = qk_param_str(qiskit_param_.get());
+        char* str = qk_param_str(qk_param());
         std::string ret = str;
         qk_str_free(str);
         return ret;
@@ -104,141 +134,195 @@ public:
     /// @brief get value of the Parameter expression
     /// @param out a reference to the returned value
 	/// @return true if real number can be obtained
-    double as_real(void)
+    double as_real(void) const
     {
+        if (numeric_) {
+            return value_.real();
+        }
         return qk_param_as_real(qiskit_param_.get());
     }
 
     /// @brief Negate a Parameter
-	/// @return a new Parameter (-this)
-    Parameter operator-()
+    /// @param prm a Parameter
+	/// @return a new Parameter (-prm)
+    friend Parameter operator-(Parameter prm)
     {
-        Parameter ret;
-        qk_param_neg(ret.qiskit_param_.get(), qiskit_param_.get());
-        return ret;
+        if (prm.numeric_) {
+            return Parameter(-prm.value_);
+        }
+        return combine(qk_param_neg, prm);
     }
 
     /// @brief add parameters
-    /// @param prm a Parameter to be added
-	/// @return a new Parameter (this + prm)
-    Parameter operator+(const Parameter &prm)
+    /// @details A temporary operand (e.g. the result of a sub-expression) is
+    ///          reused for the result, so an expression allocates one QkParam.
+    /// @param lhs a Parameter
+    /// @param rhs a Parameter to be added
+	/// @return a new Parameter (lhs + rhs)
+    friend Parameter operator+(Parameter lhs, Parameter rhs)
     {
-        Parameter ret;
-        qk_param_add(ret.qiskit_param_.get(), qiskit_param_.get(), prm.qiskit_param_.get());
-        return ret;
+        if (lhs.numeric_ && rhs.numeric_) {
+            return Parameter(lhs.value_ + rhs.value_);
+        }
+        return combine(qk_param_add, lhs, rhs);
     }
 
     /// @brief subtract parameters
-    /// @param prm a Parameter to be subtracted
-	/// @return a new Parameter (this - prm)
-    Parameter operator-(const Parameter &prm)
+    /// @param lhs a Parameter
+    /// @param rhs a Parameter to be subtracted
+	/// @return a new Parameter (lhs - rhs)
+    friend Parameter operator-(Parameter lhs, Parameter rhs)
     {
-        Parameter ret;
-        qk_param_sub(ret.qiskit_param_.get(), qiskit_param_.get(), prm.qiskit_param_.get());
-        return ret;
+        if (lhs.numeric_ && rhs.numeric_) {
+            return Parameter(lhs.value_ - rhs.value_);
+        }
+        return combine(qk_param_sub, lhs, rhs);
     }
 
     /// @brief multiply parameters
-    /// @param prm a Parameter to be multiplied
-	/// @return a new Parameter (this * prm)
-    Parameter operator*(const Parameter &prm)
+    /// @param lhs a Parameter
+    /// @param rhs a Parameter to be multiplied
+	/// @return a new Parameter (lhs * rhs)
+    friend Parameter operator*(Parameter lhs, Parameter rhs)
     {
-        Parameter ret;
-        qk_param_mul(ret.qiskit_param_.get(), qiskit_param_.get(), prm.qiskit_param_.get());
-        return ret;
+        if (lhs.numeric_ && rhs.numeric_) {
+            return Parameter(lhs.value_ * rhs.value_);
+        }
+        return combine(qk_param_mul, lhs, rhs);
     }
 
-    /// @brief divide by a Parameter
-    /// @param prm a Parameter to be divided by
-	/// @return a new Parameter (this / prm)
-    Parameter operator/(const Parameter &prm)
+    /// @brief divide parameters
+    /// @param lhs a Parameter
+    /// @param rhs a Parameter to be divided by
+	/// @return a new Parameter (lhs / rhs)
+    friend Parameter operator/(Parameter lhs, Parameter rhs)
     {
-        Parameter ret;
-        qk_param_div(ret.qiskit_param_.get(), qiskit_param_.get(), prm.qiskit_param_.get());
-        return ret;
+        if (lhs.numeric_ && rhs.numeric_ && rhs.value_ != 0.0) {
+            return Parameter(lhs.value_ / rhs.value_);
+        }
+        return combine(qk_param_div, lhs, rhs);
     }
 
     /// @brief add a value
-    /// @param prm a floating point value to be added
-	/// @return a new Parameter (this + prm)
-    Parameter operator+(const double prm)
+    /// @param lhs a Parameter
+    /// @param rhs a floating point value to be added
+	/// @return a new Parameter (lhs + rhs)
+    friend Parameter operator+(Parameter lhs, const double rhs)
     {
-        Parameter ret;
-        Parameter rhs(prm);
-        qk_param_add(ret.qiskit_param_.get(), qiskit_param_.get(), rhs.qiskit_param_.get());
-        return ret;
+        return std::move(lhs) + Parameter(rhs);
     }
 
     /// @brief subtract a value
-    /// @param prm a floating point value to be subtracted
-	/// @return a new Parameter (this - prm)
-    Parameter operator-(const double prm)
+    /// @param lhs a Parameter
+    /// @param rhs a floating point value to be subtracted
+	/// @return a new Parameter (lhs - rhs)
+    friend Parameter operator-(Parameter lhs, const double rhs)
     {
-        Parameter ret;
-        Parameter rhs(prm);
-        qk_param_sub(ret.qiskit_param_.get(), qiskit_param_.get(), rhs.qiskit_param_.get());
-        return ret;
+        return std::move(lhs) - Parameter(rhs);
     }
 
     /// @brief multiply a value
-    /// @param prm a floating point value to be multiplied
-	/// @return a new Parameter (this * prm)
-    Parameter operator*(const double prm)
+    /// @param lhs a Parameter
+    /// @param rhs a floating point value to be multiplied
+	/// @return a new Parameter (lhs * rhs)
+    friend Parameter operator*(Parameter lhs, const double rhs)
     {
-        Parameter ret;
-        Parameter rhs(prm);
-        qk_param_mul(ret.qiskit_param_.get(), qiskit_param_.get(), rhs.qiskit_param_.get());
-        return ret;
+        return std::move(lhs) * Parameter(rhs);
     }
 
     /// @brief divide by a value
-    /// @param prm a floating point value to be divided by
-	/// @return a new Parameter (this / prm)
-    Parameter operator/(const double prm)
+    /// @param lhs a Parameter
+    /// @param rhs a floating point value to be divided by
+	/// @return a new Parameter (lhs / rhs)
+    friend Parameter operator/(Parameter lhs, const double rhs)
     {
-        Parameter ret;
-        Parameter rhs(prm);
-        qk_param_div(ret.qiskit_param_.get(), qiskit_param_.get(), rhs.qiskit_param_.get());
-        return ret;
+        return std::move(lhs) / Parameter(rhs);
+    }
+
+    /// @brief add a Parameter to a value
+    /// @param lhs a floating point value
+    /// @param rhs a Parameter to be added
+	/// @return a new Parameter (lhs + rhs)
+    friend Parameter operator+(const double lhs, Parameter rhs)
+    {
+        return Parameter(lhs) + std::move(rhs);
+    }
+
+    /// @brief subtract a Parameter from a value
+    /// @param lhs a floating point value
+    /// @param rhs a Parameter to be subtracted
+	/// @return a new Parameter (lhs - rhs)
+    friend Parameter operator-(const double lhs, Parameter rhs)
+    {
+        return Parameter(lhs) - std::move(rhs);
+    }
+
+    /// @brief multiply a Parameter to a value
+    /// @param lhs a floating point value
+    /// @param rhs a Parameter to be multiplied
+	/// @return a new Parameter (lhs * rhs)
+    friend Parameter operator*(const double lhs, Parameter rhs)
+    {
+        return Parameter(lhs) * std::move(rhs);
+    }
+
+    /// @brief divide a value by a Parameter
+    /// @param lhs a floating point value
+    /// @param rhs a Parameter to be divided by
+	/// @return a new Parameter (lhs / rhs)
+    friend Parameter operator/(const double lhs, Parameter rhs)
+    {
+        return Parameter(lhs) / std::move(rhs);
     }
 
     /// @brief calculate this Parameter raised to the power other Parameter
     /// @param prm an exponent Parameter
 	/// @return a new Parameter (this ^ prm)
-    Parameter pow(const Parameter &prm)
+    Parameter pow(const Parameter &prm) const
     {
-        Parameter ret;
-        qk_param_pow(ret.qiskit_param_.get(), qiskit_param_.get(), prm.qiskit_param_.get());
-        return ret;
+        if (is_real() && prm.is_real() && (value_.real() > 0.0 || prm.value_.real() == std::floor(prm.value_.real()))) {
+            return Parameter(std::pow(value_.real(), prm.value_.real()));
+        }
+        return apply(qk_param_pow, prm);
     }
 
     /// @brief calculate this Parameter raised to the power a value
     /// @param prm an exponent value
 	/// @return a new Parameter (this ^ prm)
-    Parameter pow(const double prm)
+    Parameter pow(const double prm) const
     {
-        Parameter ret;
-        Parameter rhs(prm);
-        qk_param_pow(ret.qiskit_param_.get(), qiskit_param_.get(), rhs.qiskit_param_.get());
-        return ret;
+        return pow(Parameter(prm));
     }
 
     /// @brief Copy parameter from other
+    /// @details The expression is shared as in the copy constructor, and it
+    ///          is copied when either Parameter is modified in place.
     /// @param prm source Parameter
     Parameter &operator=(const Parameter &prm)
     {
-        if (qiskit_param_)
-            qiskit_param_.reset();
-        qiskit_param_ = std::shared_ptr<qiskit_param>(qk_param_copy(prm.qiskit_param_.get()), qk_param_free);
+        qiskit_param_ = prm.qiskit_param_;
+        value_ = prm.value_;
+        numeric_ = prm.numeric_;
         return *this;
     }
 
+    /// @brief Move parameter from other
+    /// @param prm source Parameter, left as zero
+    Parameter &operator=(Parameter &&prm)
+    {
+        return replace(std::move(prm));
+    }
+
     /// @brief add other Parameter to this Parameter
     /// @param rhs a Parameter to be added
 	/// @return a reference to this
     Parameter &operator+=(const Parameter &rhs)
     {
-        qk_param_add(qiskit_param_.get(), qiskit_param_.get(), rhs.qiskit_param_.get());
+        if (numeric_) {
+            return replace(*this + rhs);
+        }
+        detach();
+        qk_param_add(qiskit_param_.get(), qiskit_param_.get(), rhs.qk_param());
         return *this;
     }
 
@@ -247,10 +331,7 @@ public:
 	/// @return a reference to this
     Parameter &operator+=(const double rhs)
     {
-        qiskit_param* rval = qk_param_from_double(rhs);
-        qk_param_add(qiskit_param_.get(), qiskit_param_.get(), rval);
-        qk_param_free(rval);
-        return *this;
+        return *this += Parameter(rhs);
     }
 
     /// @brief subtract this Parameter and other Parameter
@@ -258,7 +339,11 @@ public:
 	/// @return a reference to this
     Parameter &operator-=(const Parameter &rhs)
     {
-        qk_param_sub(qiskit_param_.get(), qiskit_param_.get(), rhs.qiskit_param_.get());
+        if (numeric_) {
+            return replace(*this - rhs);
+        }
+        detach();
+        qk_param_sub(qiskit_param_.get(), qiskit_param_.get(), rhs.qk_param());
         return *this;
     }
 
@@ -267,10 +352,7 @@ public:
 	/// @return a reference to this
     Parameter &operator-=(const double rhs)
     {
-        qiskit_param* rval = qk_param_from_double(rhs);
-        qk_param_sub(qiskit_param_.get(), qiskit_param_.get(), rval);
-        qk_param_free(rval);
-        return *this;
+        return *this -= Parameter(rhs);
     }
 
     /// @brief multiply other Parameter to this Parameter
@@ -278,7 +360,11 @@ public:
 	/// @return a reference to this
     Parameter &operator*=(const Parameter &rhs)
     {
-        qk_param_mul(qiskit_param_.get(), qiskit_param_.get(), rhs.qiskit_param_.get());
+        if (numeric_) {
+            return replace(*this * rhs);
+        }
+        detach();
+        qk_param_mul(qiskit_param_.get(), qiskit_param_.get(), rhs.qk_param());
         return *this;
     }
 
@@ -287,10 +373,7 @@ public:
 	/// @return a reference to this
     Parameter &operator*=(const double rhs)
     {
-        qiskit_param* rval = qk_param_from_double(rhs);
-        qk_param_mul(qiskit_param_.get(), qiskit_param_.get(), rval);
-        qk_param_free(rval);
-        return *this;
+        return *this *= Parameter(rhs);
     }
 
     /// @brief divide this Parameter by other Parameter
@@ -298,7 +381,11 @@ public:
 	/// @return a reference to this
     Parameter &operator/=(const Parameter &rhs)
     {
-        qk_param_div(qiskit_param_.get(), qiskit_param_.get(), rhs.qiskit_param_.get());
+        if (numeric_) {
+            return replace(*this / rhs);
+        }
+        detach();
+        qk_param_div(qiskit_param_.get(), qiskit_param_.get(), rhs.qk_param());
         return *this;
     }
 
@@ -307,10 +394,7 @@ public:
 	/// @return a reference to this
     Parameter &operator/=(const double rhs)
     {
-        qiskit_param* rval = qk_param_from_double(rhs);
-        qk_param_div(qiskit_param_.get(), qiskit_param_.get(), rval);
-        qk_param_free(rval);
-        return *this;
+        return *this /= Parameter(rhs);
     }
 
     /// @brief compare 2 Parameters
@@ -318,7 +402,10 @@ public:
 	/// @return true if 2 Parameters are equal
     bool operator==(const Parameter &rhs) const
     {
-        return qk_param_equal(qiskit_param_.get(), rhs.qiskit_param_.get());
+        if (numeric_ && rhs.numeric_) {
+            return value_ == rhs.value_;
+        }
+        return qk_param_equal(qk_param(), rhs.qk_param());
     }
 
     /// @brief compare 2 Parameters
@@ -326,7 +413,7 @@ public:
 	/// @return true if 2 Parameters are equal
     bool operator!=(const Parameter &rhs) const
     {
-        return !qk_param_equal(qiskit_param_.get(), rhs.qiskit_param_.get());
+        return !(*this == rhs);
     }
 
 
@@ -350,101 +437,113 @@ public:
 
     /// @brief calculate exponent of this Parameter
 	/// @return a new Parameter for the result
-    Parameter exp(void)
+    Parameter exp(void) const
     {
-        Parameter ret;
-        qk_param_exp(ret.qiskit_param_.get(), qiskit_param_.get());
-        return ret;
+        if (is_real()) {
+            return Parameter(std::exp(value_.real()));
+        }
+        return apply(qk_param_exp);
     }
 
     /// @brief calculate log of this Parameter
 	/// @return a new Parameter for the result
-    Parameter log(void)
+    Parameter log(void) const
     {
-        Parameter ret;
-        qk_param_log(ret.qiskit_param_.get(), qiskit_param_.get());
-        return ret;
+        if (is_real() && value_.real() > 0.0) {
+            return Parameter(std::log(value_.real()));
+        }
+        return apply(qk_param_log);
     }
 
     /// @brief calculate absolute of this Parameter
 	/// @return a new Parameter for the result
-    Parameter abs(void)
+    Parameter abs(void) const
     {
-        Parameter ret;
-        qk_param_abs(ret.qiskit_param_.get(), qiskit_param_.get());
-        return ret;
+        if (numeric_) {
+            return Parameter(std::abs(value_));
+        }
+        return apply(qk_param_abs);
     }
 
     /// @brief calculate sine of this Parameter
 	/// @return a new Parameter for the result
-    Parameter sin(void)
+    Parameter sin(void) const
     {
-        Parameter ret;
-        qk_param_sin(ret.qiskit_param_.get(), qiskit_param_.get());
-        return ret;
+        if (is_real()) {
+            return Parameter(std::sin(value_.real()));
+        }
+        return apply(qk_param_sin);
     }
 
     /// @brief calculate cosine of this Parameter
 	/// @return a new Parameter for the result
-    Parameter cos(void)
+    Parameter cos(void) const
     {
-        Parameter ret;
-        qk_param_cos(ret.qiskit_param_.get(), qiskit_param_.get());
-        return ret;
+        if (is_real()) {
+            return Parameter(std::cos(value_.real()));
+        }
+        return apply(qk_param_cos);
     }
 
     /// @brief calculate tangent of this Parameter
 	/// @return a new Parameter for the result
-    Parameter tan(void)
+    Parameter tan(void) const
     {
-        Parameter ret;
-        qk_param_tan(ret.qiskit_param_.get(), qiskit_param_.get());
-        return ret;
+        if (is_real()) {
+            return Parameter(std::tan(value_.real()));
+        }
+        return apply(qk_param_tan);
     }
 
     /// @brief calculate arcsine of this Parameter
 	/// @return a new Parameter for the result
-    Parameter asin(void)
+    Parameter asin(void) const
     {
-        Parameter ret;
-        qk_param_asin(ret.qiskit_param_.get(), qiskit_param_.get());
-        return ret;
+        if (is_real() && std::fabs(value_.real()) <= 1.0) {
+            return Parameter(std::asin(value_.real()));
+        }
+        return apply(qk_param_asin);
     }
 
     /// @brief calculate arccosine of this Parameter
 	/// @return a new Parameter for the result
-    Parameter acos(void)
+    Parameter acos(void) const
     {
-        Parameter ret;
-        qk_param_acos(ret.qiskit_param_.get(), qiskit_param_.get());
-        return ret;
+        if (is_real() && std::fabs(value_.real()) <= 1.0) {
+            return Parameter(std::acos(value_.real()));
+        }
+        return apply(qk_param_acos);
     }
 
     /// @brief calculate arctangent of this Parameter
 	/// @return a new Parameter for the result
-    Parameter atan(void)
+    Parameter atan(void) const
     {
-        Parameter ret;
-        qk_param_atan(ret.qiskit_param_.get(), qiskit_param_.get());
-        return ret;
+        if (is_real()) {
+            return Parameter(std::atan(value_.real()));
+        }
+        return apply(qk_param_atan);
     }
 
     /// @brief calculate sign of this Parameter
 	/// @return a new Parameter for the result
-    Parameter sign(void)
+    Parameter sign(void) const
     {
-        Parameter ret;
-        qk_param_sign(ret.qiskit_param_.get(), qiskit_param_.get());
-        return ret;
+        if (is_real()) {
+            double v = value_.real();
+            return Parameter((double)((v > 0.0) - (v < 0.0)));
+        }
+        return apply(qk_param_sign);
     }
 
     /// @brief calculate conjugate of this Parameter
 	/// @return a new Parameter for the result
-    Parameter conjugate(void)
+    Parameter conjugate(void) const
     {
-        Parameter ret;
-        qk_param_conjugate(ret.qiskit_param_.get(), qiskit_param_.get());
-        return ret;
+        if (numeric_) {
+            return Parameter(std::conj(value_));
+        }
+        return apply(qk_param_conjugate);
     }
 
 #ifdef QISKIT_CAPI_HAS_SUBS
@@ -454,9 +553,10 @@ public:
 	/// @return a new bound Parameter
     Parameter bind(const Parameter& symbol, const double value)
     {
-        Parameter ret;
+        Parameter ret(qk_param_zero());
+        const qiskit_param* key = symbol.qk_param();
 
-        qk_param_bind(ret.qiskit_param_.get(), qiskit_param_.get(), &symbol.qiskit_param_.get(), &value, 1);
+        qk_param_bind(ret.qk_param(), qk_param(), &key, &value, 1);
         return ret;
     }
 
@@ -464,16 +564,16 @@ public:
     /// @param symbols a list symbols to be bound
     /// @param value a list of values to be set
 	/// @return a new bound Parameter
-    Parameter bind(const std::vector<Parameter>& symbols, const std::vector<double> values)
+    Parameter bind(const std::vector<Parameter>& symbols, const std::vector<double>& values)
     {
         size_t size = std::min(symbols.size(), values.size());
-        Parameter ret;
-        std::vector<qiskit_param*> list(size);
+        Parameter ret(qk_param_zero());
+        std::vector<const qiskit_param*> list(size);
         for (uint_t i = 0; i < size; i++) {
-            list[i] = symbols[i].qiskit_param_.get();
+            list[i] = symbols[i].qk_param();
         }
 
-        qk_param_bind(ret.qiskit_param_.get(), qiskit_param_.get(), list.data(), values.data(), size);
+        qk_param_bind(ret.qk_param(), qk_param(), list.data(), values.data(), size);
         return ret;
 
     }
@@ -484,9 +584,11 @@ public:
 	/// @return a new substituted Parameter
     Parameter subs(const Parameter& symbol, const Parameter& other)
     {
-        Parameter ret;
+        Parameter ret(qk_param_zero());
+        const qiskit_param* key = symbol.qk_param();
+        const qiskit_param* value = other.qk_param();
 
-        qk_param_subs(ret.qiskit_param_.get(), qiskit_param_.get(), &symbol.qiskit_param_.get(), &other.qiskit_param_.get(), 1);
+        qk_param_subs(ret.qk_param(), qk_param(), &key, &value, 1);
         return ret;
     }
 
@@ -496,21 +598,192 @@ public:
 	/// @return a new substituted Parameter
     Parameter subs(const std::vector<Parameter>& symbols, const std::vector<Parameter>& others)
     {
-        size_t size = std::min(symbols.size(), values.size());
-        Parameter ret;
-        std::vector<qiskit_param*> slist(size);
-        std::vector<qiskit_param*> olist(size);
+        size_t size = std::min(symbols.size(), others.size());
+        Parameter ret(qk_param_zero());
+        std::vector<const qiskit_param*> slist(size);
+        std::vector<const qiskit_param*> olist(size);
         for (uint_t i = 0; i < size; i++) {
-            slist[i] = symbols[i].qiskit_param_.get();
-            olist[i] = others[i].qiskit_param_.get();
+            slist[i] = symbols[i].qk_param();
+            olist[i] = others[i].qk_param();
         }
 
-        qk_param_bind(ret.qiskit_param_.get(), qiskit_param_.get(), slist.data(), olist.data(), size);
+        qk_param_subs(ret.qk_param(), qk_param(), slist.data(), olist.data(), size);
         return ret;
     }
 #endif
 
+    /// @brief Return names of symbols in the Parameter expression
+    /// @return a list of symbol names in order of appearance
+    std::vector<std::string> symbols(void) const
+    {
+        std::vector<std::string> names;
+        if (numeric_) {
+            return names;
+        }
+        char* str = qk_param_str(qk_param());
+        parse_symbols(str, names);
+        qk_str_free(str);
+        return names;
+    }
+
+    /// @brief Extract symbol names from a string expression of a Parameter
+    /// @details Identifiers followed by '(' are functions and skipped. A
+    ///          trailing index in brackets is a part of the name (e.g. theta[3]).
+    /// @param expr a string expression
+    /// @param names a list of names to which new symbols are appended
+    static void parse_symbols(const char* expr, std::vector<std::string>& names)
+    {
+        for_each_symbol(expr, [&names](const char* begin, const char* end) {
+            std::string name(begin, end - begin);
+            if (std::find(names.begin(), names.end(), name) == names.end()) {
+                names.push_back(name);
+            }
+        });
+    }
+
+    /// @brief Call a function for each symbol in a string expression of a Parameter
+    /// @details Symbols are scanned in the same way as parse_symbols, so
+    ///          a symbol is never a part of another symbol (e.g. theta in theta[0]).
+    /// @param expr a string expression
+    /// @param func a function called with the range [begin, end) of each symbol
+    template <typename F>
+    static void for_each_symbol(const char* expr, F func)
+    {
+        const char* p = expr;
+        while (*p != '\0') {
+            unsigned char c = (unsigned char)*p;
+            if (std::isdigit(c) || c == '.') {
+                // numbers including exponent and imaginary unit (e.g. 1.5e-3, 2i)
+                while (std::isalnum((unsigned char)*p) || *p == '.' ||
+                       ((*p == '-' || *p == '+') && (p[-1] == 'e' || p[-1] == 'E'))) {
+                    p++;
+                }
+            } else if (std::isalpha(c) || c == '_' || c >= 0x80) {
+                const char* begin = p;
+                while (std::isalnum((unsigned char)*p) || *p == '_' || (unsigned char)*p >= 0x80) {
+                    p++;
+                }
+                if (*p == '[') {
+                    while (*p != '\0' && *p != ']') {
+                        p++;
+                    }
+                    if (*p == ']') {
+                        p++;
+                    }
+                }
+                if (*p == '(') {
+                    continue;
+                }
+                func(begin, p);
+            } else {
+                p++;
+            }
+        }
+    }
+
+    /// @brief Compare symbol names in the order of circuit parameters
+    /// @details Names are compared as strings, except that elements of the
+    ///          same parameter vector are compared by index (theta[2] < theta[10]).
+    /// @param a a symbol name
+    /// @param b a symbol name
+    /// @return true if a comes before b
+    static bool symbol_less(const std::string& a, const std::string& b)
+    {
+        size_t pa = a.find('[');
+        size_t pb = b.find('[');
+        if (pa != std::string::npos && pb != std::string::npos && pa == pb && a.compare(0, pa, b, 0, pb) == 0) {
+            unsigned long ia = std::strtoul(a.c_str() + pa + 1, nullptr, 10);
+            unsigned long ib = std::strtoul(b.c_str() + pb + 1, nullptr, 10);
+            if (ia != ib) {
+                return ia < ib;
+            }
+        }
+        return a < b;
+    }
+
     friend std::ostream& operator<<(std::ostream& os, const Parameter& p);
+protected:
+    // return QkParam of this, allocating it for a number
+    qiskit_param *qk_param(void) const
+    {
+        if (!qiskit_param_) {
+            if (value_.imag() == 0.0) {
+                qiskit_param_ = std::shared_ptr<qiskit_param>(qk_param_from_double(value_.real()), qk_param_free);
+            } else {
+                std::complex<double> v = value_;
+                qiskit_param_ = std::shared_ptr<qiskit_param>(qk_param_from_complex(qk_complex64_from_native(&v)), qk_param_free);
+            }
+        }
+        return qiskit_param_.get();
+    }
+
+    Parameter apply(unary_op op) const
+    {
+        Parameter ret(qk_param_zero());
+        op(ret.qiskit_param_.get(), qk_param());
+        return ret;
+    }
+
+    Parameter apply(binary_op op, const Parameter &rhs) const
+    {
+        Parameter ret(qk_param_zero());
+        op(ret.qiskit_param_.get(), qk_param(), rhs.qk_param());
+        return ret;
+    }
+
+    // take the result of an operation without copying its QkParam
+    Parameter &replace(Parameter &&prm)
+    {
+        if (&prm == this) {
+            return *this;
+        }
+        qiskit_param_ = std::move(prm.qiskit_param_);
+        value_ = prm.value_;
+        numeric_ = prm.numeric_;
+        prm.value_ = 0.0;
+        prm.numeric_ = true;
+        return *this;
+    }
+
+    // copy the expression before modifying it in place if it is shared
+    void detach(void)
+    {
+        if (qiskit_param_.use_count() > 1) {
+            qiskit_param_ = std::shared_ptr<qiskit_param>(qk_param_copy(qiskit_param_.get()), qk_param_free);
+        }
+    }
+
+    // apply op writing the result over an operand which is not shared with other Parameters
+    static Parameter combine(binary_op op, Parameter &lhs, Parameter &rhs)
+    {
+        const qiskit_param *l = lhs.qk_param();
+        const qiskit_param *r = rhs.qk_param();
+        Parameter ret;
+        ret.numeric_ = false;
+        if (lhs.qiskit_param_.use_count() == 1) {
+            ret.qiskit_param_ = std::move(lhs.qiskit_param_);
+        } else if (rhs.qiskit_param_.use_count() == 1) {
+            ret.qiskit_param_ = std::move(rhs.qiskit_param_);
+        } else {
+            ret.qiskit_param_ = std::shared_ptr<qiskit_param>(qk_param_zero(), qk_param_free);
+        }
+        op(ret.qiskit_param_.get(), l, r);
+        return ret;
+    }
+
+    static Parameter combine(unary_op op, Parameter &prm)
+    {
+        const qiskit_param *p = prm.qk_param();
+        Parameter ret;
+        ret.numeric_ = false;
+        if (prm.qiskit_param_.use_count() == 1) {
+            ret.qiskit_param_ = std::move(prm.qiskit_param_);
+        } else {
+            ret.qiskit_param_ = std::shared_ptr<qiskit_param>(qk_param_zero(), qk_param_free);
+        }
+        op(ret.qiskit_param_.get(), p);
+        return ret;
+    }
 
 };
 
@@ -0,0 +1,153 @@
+/*
+# This code is part of Qiskit.
+#
+# (C) Copyright IBM 2026.
+#
+# This code is licensed under the Apache License, Version 2.0. You may
+# obtain a copy of this license in the LICENSE.txt file in the root directory
+# of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# Any modifications or derivative works of this code must retain this
+# copyright notice, and modified files need to carry a notice indicating
+# that they have been altered from the originals.
+*/
+
+// index of parameter symbols in a circuit
+
+#ifndef __qiskitcpp_circuit_parameter_table_hpp__
+#define __qiskitcpp_circuit_parameter_table_hpp__
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "utils/types.hpp"
+#include "circuit/parameter.hpp"
+
+namespace Qiskit {
+namespace circuit {
+
+/// @struct ParameterReference
+/// @brief A parameter slot of an instruction referencing a symbol
+struct ParameterReference {
+    uint_t instruction;     // index of the instruction in the circuit
+    uint_t slot;            // index of the parameter of the instruction
+    bool is_symbol;         // true if the parameter is the symbol itself, not an expression of it
+
+    bool operator==(const ParameterReference &other) const
+    {
+        return instruction == other.instruction && slot == other.slot && is_symbol == other.is_symbol;
+    }
+
+    bool operator<(const ParameterReference &other) const
+    {
+        return instruction < other.instruction || (instruction == other.instruction && slot < other.slot);
+    }
+};
+
+/// @class ParameterTable
+/// @brief Map from each parameter symbol to the instruction slots referencing it.
+/// @details References are appended in order of instructions, so the list of
+///          each symbol is sorted. Symbols are kept in the circuit parameter
+///          order (see Parameter::symbol_less).
+class ParameterTable {
+protected:
+    struct SymbolLess {
+        bool operator()(const std::string &a, const std::string &b) const
+        {
+            return Parameter::symbol_less(a, b);
+        }
+    };
+    std::map<std::string, std::vector<ParameterReference>, SymbolLess> table_;
+    uint_t num_references_ = 0;
+public:
+    using const_iterator = std::map<std::string, std::vector<ParameterReference>, SymbolLess>::const_iterator;
+
+    /// @brief Create an empty table
+    ParameterTable() {}
+
+    /// @brief Add a parameter slot referencing symbols
+    /// @param instruction index of the instruction
+    /// @param slot index of the parameter in the instruction
+    /// @param symbols names of symbols in the parameter expression
+    /// @param is_symbol true if the parameter is a symbol, not an expression
+    void add(const uint_t instruction, const uint_t slot, const std::vector<std::string> &symbols, const bool is_symbol = false)
+    {
+        ParameterReference ref = {instruction, slot, is_symbol};
+        for (auto &name : symbols) {
+            table_[name].push_back(ref);
+            num_references_++;
+        }
+    }
+
+    /// @brief Return the number of symbols
+    /// @return the number of symbols
+    uint_t size(void) const
+    {
+        return table_.size();
+    }
+
+    /// @brief Return the total number of references
+    /// @return the number of references of all symbols
+    uint_t num_references(void) const
+    {
+        return num_references_;
+    }
+
+    /// @brief Check if the symbol is referenced
+    /// @param name name of the symbol
+    /// @return true if the symbol is in the table
+    bool contains(const std::string &name) const
+    {
+        return table_.find(name) != table_.end();
+    }
+
+    /// @brief Return references of a symbol
+    /// @param name name of the symbol
+    /// @return a list of references sorted by instruction (empty if the symbol is not in the table)
+    const std::vector<ParameterReference> &references(const std::string &name) const
+    {
+        static const std::vector<ParameterReference> empty;
+        auto it = table_.find(name);
+        if (it == table_.end()) {
+            return empty;
+        }
+        return it->second;
+    }
+
+    /// @brief Return names of symbols
+    /// @return a list of names in the circuit parameter order
+    std::vector<std::string> names(void) const
+    {
+        std::vector<std::string> ret;
+        ret.reserve(table_.size());
+        for (auto &entry : table_) {
+            ret.push_back(entry.first);
+        }
+        return ret;
+    }
+
+    /// @brief Return an iterator to the first pair of a symbol name and its references
+    const_iterator begin(void) const
+    {
+        return table_.begin();
+    }
+
+    /// @brief Return an iterator past the last symbol
+    const_iterator end(void) const
+    {
+        return table_.end();
+    }
+
+    /// @brief Remove all symbols
+    void clear(void)
+    {
+        table_.clear();
+        num_references_ = 0;
+    }
+};
+
+} // namespace circuit
+} // namespace Qiskit
+
+#endif  // __qiskitcpp_circuit_parameter_table_hpp__
@@ -25,14 +25,26 @@
 #include <iomanip>
 #include <cstring>
 #include <cassert>
+#include <cmath>
+#include <cctype>
+#include <unordered_map>
+#include <unordered_set>
+#include <map>
+#include <atomic>
 
 #include "utils/types.hpp"
+#include "utils/fingerprint.hpp"
+#include "utils/thread_pool.hpp"
 #include "circuit/parameter.hpp"
 //#include "circuit/classical/expr.hpp"
 #include "circuit/classicalregister.hpp"
 #include "circuit/quantumregister.hpp"
 #include "circuit/library/standard_gates/standard_gates.hpp"
 #include "circuit/circuitinstruction.hpp"
+#include "circuit/instruction_view.hpp"
+#include "circuit/circuit_metrics.hpp"
+#include "circuit/parameter_table.hpp"
+#include "circuit/compiled_expression.hpp"
 
 #include "circuit/barrier.hpp"
 #include "circuit/measure.hpp"
@@ -66,19 +78,29 @@ static Parameter null_param;
 class QuantumCircuit
 {
 protected:
-	uint_t num_qubits_;			// number of qubits
-	uint_t num_clbits_;			// number of classical bits
+	uint_t num_qubits_ = 0;		// number of qubits
+	uint_t num_clbits_ = 0;		// number of classical bits
 	double global_phase_ = 0.0; // initial global phase
 
-	std::vector<QuantumRegister> qregs_;   // quantum registers
-	std::vector<ClassicalRegister> cregs_; // classical registers
+	// copies of a circuit share the following data, and it is cloned by detach() before modification
+	std::shared_ptr<std::vector<QuantumRegister>> qregs_ = std::make_shared<std::vector<QuantumRegister>>();   // quantum registers (not modified after construction)
+	std::shared_ptr<std::vector<ClassicalRegister>> cregs_ = std::make_shared<std::vector<ClassicalRegister>>(); // classical registers (not modified after construction)
 
 	std::shared_ptr<rust_circuit> rust_circuit_ = nullptr; // shared pointer to the circuit for Rust
 
 	std::shared_ptr<ControlFlowOp> pending_control_flow_op_ = nullptr; // shared pointer to control flow object
 
-	reg_t qubit_map_;									 // qubit map caused by transpiling
-	std::vector<std::pair<uint_t, uint_t>> measure_map_; // a list of pair of qubit and clbit for measure
+	std::shared_ptr<reg_t> qubit_map_ = std::make_shared<reg_t>();	// qubit map caused by transpiling
+	std::shared_ptr<std::vector<std::pair<uint_t, uint_t>>> measure_map_ = std::make_shared<std::vector<std::pair<uint_t, uint_t>>>(); // a list of pair of qubit and clbit for measure
+	std::shared_ptr<std::vector<std::pair<uint_t, std::shared_ptr<const std::vector<complex_t>>>>> unitary_ops_ =
+		std::make_shared<std::vector<std::pair<uint_t, std::shared_ptr<const std::vector<complex_t>>>>>(); // unitary matrices sorted by instruction index
+	std::shared_ptr<CircuitMetrics> metrics_ = std::make_shared<CircuitMetrics>();	// depth and counts updated when an instruction is added
+	std::shared_ptr<ParameterTable> parameter_table_ = std::make_shared<ParameterTable>();	// symbols and instruction slots referencing them
+
+	Fingerprint ops_fingerprint_;	// hash of instructions, updated when an instruction is added
+	bool hashable_ = true;	// false if ops_fingerprint_ misses matrices of unitaries set by a transpiler
+	std::shared_ptr<const reg_t> op_start_times_ = nullptr;	// start time of each instruction in dt set by scheduling
+	uint_t duration_ = 0;	// duration of the scheduled circuit in dt
 public:
 	/// @brief Create a new QuantumCircuit
 	QuantumCircuit() {}
@@ -93,20 +115,20 @@ public:
 		num_clbits_ = num_clbits;
 		global_phase_ = global_phase;
 
-		qregs_.resize(1);
-		cregs_.resize(1);
+		qregs_->resize(1);
+		cregs_->resize(1);
 
 		QuantumRegister qr(num_qubits_);
 		ClassicalRegister cr(num_clbits_);
-		qregs_[0] = qr;
-		cregs_[0] = cr;
+		(*qregs_)[0] = qr;
+		(*cregs_)[0] = cr;
 
 		rust_circuit_ = std::shared_ptr<rust_circuit>(qk_circuit_new(0, 0), qk_circuit_free);
-		qk_circuit_add_quantum_register(rust_circuit_.get(), qregs_[0].get_register().get());
-		qk_circuit_add_classical_register(rust_circuit_.get(), cregs_[0].get_register().get());
+		qk_circuit_add_quantum_register(rust_circuit_.get(), (*qregs_)[0].get_register().get());
+		qk_circuit_add_classical_register(rust_circuit_.get(), (*cregs_)[0].get_register().get());
 
 		if (global_phase != 0.0) {
-			qk_circuit_gate(rust_circuit_.get(), QkGate_GlobalPhase, nullptr, &global_phase_);
+			add_gate(QkGate_GlobalPhase, nullptr, &global_phase_);
 		}
 	}
 
@@ -120,19 +142,19 @@ public:
 		num_clbits_ = creg.size();
 		global_phase_ = global_phase;
 
-		qregs_.resize(1);
-		cregs_.resize(1);
+		qregs_->resize(1);
+		cregs_->resize(1);
 
-		qregs_[0] = qreg;
-		cregs_[0] = creg;
+		(*qregs_)[0] = qreg;
+		(*cregs_)[0] = creg;
 
 		rust_circuit_ = std::shared_ptr<rust_circuit>(qk_circuit_new(0, 0), qk_circuit_free);
 
-		qk_circuit_add_quantum_register(rust_circuit_.get(), qregs_[0].get_register().get());
-		qk_circuit_add_classical_register(rust_circuit_.get(), cregs_[0].get_register().get());
+		qk_circuit_add_quantum_register(rust_circuit_.get(), (*qregs_)[0].get_register().get());
+		qk_circuit_add_classical_register(rust_circuit_.get(), (*cregs_)[0].get_register().get());
 
 		if (global_phase != 0.0) {
-			qk_circuit_gate(rust_circuit_.get(), QkGate_GlobalPhase, nullptr, &global_phase_);
+			add_gate(QkGate_GlobalPhase, nullptr, &global_phase_);
 		}
 	}
 
@@ -146,56 +168,111 @@ public:
 		num_clbits_ = 0;
 		global_phase_ = global_phase;
 
-		qregs_.resize(qregs.size());
-		cregs_.resize(cregs.size());
+		qregs_->resize(qregs.size());
+		cregs_->resize(cregs.size());
 
 		for (uint_t i = 0; i < qregs.size(); i++) {
-			qregs_[i] = qregs[i];
+			(*qregs_)[i] = qregs[i];
 			qregs[i][0].get_register()->set_base_index(num_qubits_);
-			qregs_[i].set_base_index(num_qubits_);
+			(*qregs_)[i].set_base_index(num_qubits_);
 			num_qubits_ += qregs[i].size();
 		}
 
 		for (uint_t i = 0; i < cregs.size(); i++) {
-			cregs_[i] = cregs[i];
+			(*cregs_)[i] = cregs[i];
 			cregs[i][0].get_register()->set_base_index(num_clbits_);
-			cregs_[i].set_base_index(num_clbits_);
+			(*cregs_)[i].set_base_index(num_clbits_);
 			num_clbits_ += cregs[i].size();
 		}
 
 		rust_circuit_ = std::shared_ptr<rust_circuit>(qk_circuit_new(0, 0), qk_circuit_free);
 
-		for (uint_t i = 0; i < qregs_.size(); i++) {
-			qk_circuit_add_quantum_register(rust_circuit_.get(), qregs_[i].get_register().get());
+		for (uint_t i = 0; i < qregs_->size(); i++) {
+			qk_circuit_add_quantum_register(rust_circuit_.get(), (*qregs_)[i].get_register().get());
 		}
-		for (uint_t i = 0; i < cregs_.size(); i++) {
-			qk_circuit_add_classical_register(rust_circuit_.get(), cregs_[i].get_register().get());
+		for (uint_t i = 0; i < cregs_->size(); i++) {
+			qk_circuit_add_classical_register(rust_circuit_.get(), (*cregs_)[i].get_register().get());
 		}
 
 		if (global_phase != 0.0) {
-			qk_circuit_gate(rust_circuit_.get(), QkGate_GlobalPhase, nullptr, &global_phase_);
+			add_gate(QkGate_GlobalPhase, nullptr, &global_phase_);
 		}
 	}
 
-	/// @brief Create a new reference to Quantum Circuit
-	/// @details Copy constructor of QuantumCircuit does not copy the circuit,
-	///          but copies shared pointer to Rust's circuit
-	///          If you want to make a copy of the circuit,
-	///          please call QuantumCircuit::copy explicitly.
-	/// @param circ a Quantum Circuit to be copied the refrence in the new object
+	/// @brief Create a copy of Quantum Circuit
+	/// @details The copy shares Rust's circuit and other data with the source
+	///          (copy-on-write). Shared data is cloned when either circuit is
+	///          modified for the first time.
+	/// @param circ a Quantum Circuit to be copied
 	QuantumCircuit(const QuantumCircuit &circ)
+		: num_qubits_(circ.num_qubits_), num_clbits_(circ.num_clbits_), global_phase_(circ.global_phase_),
+		  qregs_(circ.qregs_), cregs_(circ.cregs_), rust_circuit_(circ.rust_circuit_),
+		  qubit_map_(circ.qubit_map_), measure_map_(circ.measure_map_), unitary_ops_(circ.unitary_ops_),
+		  metrics_(circ.metrics_), parameter_table_(circ.parameter_table_), ops_fingerprint_(circ.ops_fingerprint_),
+		  hashable_(circ.hashable_), op_start_times_(circ.op_start_times_), duration_(circ.duration_)
 	{
-		num_qubits_ = circ.num_qubits_;
-		num_clbits_ = circ.num_clbits_;
-		global_phase_ = circ.global_phase_;
+	}
 
-		qregs_ = circ.qregs_;
-		cregs_ = circ.cregs_;
+	/// @brief Create a new Quantum Circuit by moving the source
+	/// @param circ a Quantum Circuit to be moved
+	QuantumCircuit(QuantumCircuit &&circ) noexcept
+		: num_qubits_(circ.num_qubits_), num_clbits_(circ.num_clbits_), global_phase_(circ.global_phase_),
+		  qregs_(std::move(circ.qregs_)), cregs_(std::move(circ.cregs_)), rust_circuit_(std::move(circ.rust_circuit_)),
+		  pending_control_flow_op_(std::move(circ.pending_control_flow_op_)),
+		  qubit_map_(std::move(circ.qubit_map_)), measure_map_(std::move(circ.measure_map_)), unitary_ops_(std::move(circ.unitary_ops_)),
+		  metrics_(std::move(circ.metrics_)), parameter_table_(std::move(circ.parameter_table_)), ops_fingerprint_(circ.ops_fingerprint_),
+		  hashable_(circ.hashable_), op_start_times_(std::move(circ.op_start_times_)), duration_(circ.duration_)
+	{
+	}
 
-		rust_circuit_ = circ.rust_circuit_;
+	/// @brief Copy Quantum Circuit (copy-on-write)
+	/// @param circ a Quantum Circuit to be copied
+	QuantumCircuit &operator=(const QuantumCircuit &circ)
+	{
+		if (this != &circ) {
+			num_qubits_ = circ.num_qubits_;
+			num_clbits_ = circ.num_clbits_;
+			global_phase_ = circ.global_phase_;
+			qregs_ = circ.qregs_;
+			cregs_ = circ.cregs_;
+			rust_circuit_ = circ.rust_circuit_;
+			pending_control_flow_op_.reset();
+			qubit_map_ = circ.qubit_map_;
+			measure_map_ = circ.measure_map_;
+			unitary_ops_ = circ.unitary_ops_;
+			metrics_ = circ.metrics_;
+			parameter_table_ = circ.parameter_table_;
+			ops_fingerprint_ = circ.ops_fingerprint_;
+			hashable_ = circ.hashable_;
+			op_start_times_ = circ.op_start_times_;
+			duration_ = circ.duration_;
+		}
+		return *this;
+	}
 
-		measure_map_ = circ.measure_map_;
-		qubit_map_ = circ.qubit_map_;
+	/// @brief Move Quantum Circuit
+	/// @param circ a Quantum Circuit to be moved
+	QuantumCircuit &operator=(QuantumCircuit &&circ) noexcept
+	{
+		if (this != &circ) {
+			num_qubits_ = circ.num_qubits_;
+			num_clbits_ = circ.num_clbits_;
+			global_phase_ = circ.global_phase_;
+			qregs_ = std::move(circ.qregs_);
+			cregs_ = std::move(circ.cregs_);
+			rust_circuit_ = std::move(circ.rust_circuit_);
+			pending_control_flow_op_ = std::move(circ.pending_control_flow_op_);
+			qubit_map_ = std::move(circ.qubit_map_);
+			measure_map_ = std::move(circ.measure_map_);
+			unitary_ops_ = std::move(circ.unitary_ops_);
+			metrics_ = std::move(circ.metrics_);
+			parameter_table_ = std::move(circ.parameter_table_);
+			ops_fingerprint_ = circ.ops_fingerprint_;
+			hashable_ = circ.hashable_;
+			op_start_times_ = std::move(circ.op_start_times_);
+			duration_ = circ.duration_;
+		}
+		return *this;
 	}
 
 	~QuantumCircuit()
@@ -227,30 +304,35 @@ public:
 	/// @return number of qregs
 	uint_t num_qregs(void) const
 	{
-		return qregs_.size();
+		return qregs_->size();
 	}
 
 	/// @brief Return number of cregs
 	/// @return number of cregs
 	uint_t num_cregs(void) const
 	{
-		return cregs_.size();
+		return cregs_->size();
 	}
 
 	/// @brief Return a list of qregs
 	/// @return reference to a list of qregs
 	const std::vector<QuantumRegister>& qregs(void) const
 	{
-		return qregs_;
+		return *qregs_;
 	}
 
 	/// @brief Return a list of cregs
 	/// @return reference to a list of cregs
 	const std::vector<ClassicalRegister>& cregs(void) const
 	{
-		return cregs_;
+		return *cregs_;
 	}
 
+	/// @brief Return Rust's circuit
+	/// @details The circuit may be shared with copies of this object,
+	///          so it should not be modified through the C-API.
+	/// @param update add pending control flow op before returning the circuit
+	/// @return shared pointer to Rust's circuit
 	std::shared_ptr<rust_circuit> get_rust_circuit(const bool update = true)
 	{
 		if (update)
@@ -259,22 +341,26 @@ public:
 	}
 
 	/// @brief Copy Quantum Circuit
+	/// @details Rust's circuit is cloned lazily when either circuit is modified
 	/// @return copied circuit
-	QuantumCircuit copy(void)
+	QuantumCircuit copy(void) const
 	{
-		QuantumCircuit copied;
-		copied.rust_circuit_ = std::shared_ptr<rust_circuit>(qk_circuit_copy(rust_circuit_.get()), qk_circuit_free);
-
-		copied.num_qubits_ = num_qubits_;
-		copied.num_clbits_ = num_clbits_;
-		copied.global_phase_ = global_phase_;
-
-		copied.qregs_ = qregs_;
-		copied.cregs_ = cregs_;
+		return QuantumCircuit(*this);
+	}
 
-		copied.measure_map_ = measure_map_;
-		copied.qubit_map_ = qubit_map_;
-		return copied;
+	/// @brief Return an empty circuit with the same registers
+	/// @details Registers are shared with this circuit. Instructions, global
+	///          phase and the qubit map are not copied.
+	/// @return a new circuit without instructions
+	QuantumCircuit copy_empty_like(void) const
+	{
+		QuantumCircuit circ;
+		circ.num_qubits_ = num_qubits_;
+		circ.num_clbits_ = num_clbits_;
+		circ.qregs_ = qregs_;
+		circ.cregs_ = cregs_;
+		circ.rust_circuit_ = empty_rust_circuit();
+		return circ;
 	}
 
 	/// @brief set circuit reference of Qiskit circuit
@@ -282,29 +368,37 @@ public:
 	/// @param map layout mapping
 	void set_qiskit_circuit(std::shared_ptr<rust_circuit> circ, const std::vector<uint32_t> &map)
 	{
-		if (rust_circuit_)
-			rust_circuit_.reset();
 		rust_circuit_ = circ;
 		num_qubits_ = qk_circuit_num_qubits(circ.get());
 		num_clbits_ = qk_circuit_num_clbits(circ.get());
-
-		qubit_map_.resize(map.size());
-		for (int i = 0; i < map.size(); i++) {
-			qubit_map_[i] = (uint_t)map[i];
-		}
-
-		// get measured qubits
-		uint_t nops;
-		nops = qk_circuit_num_instructions(rust_circuit_.get());
-
-		for (uint_t i = 0; i < nops; i++) {
-			QkOperationKind kind = qk_circuit_instruction_kind(rust_circuit_.get(), i);
-			if (kind == QkOperationKind_Measure) {
-				QkCircuitInstruction *op = new QkCircuitInstruction;
-				qk_circuit_get_instruction(rust_circuit_.get(), i, op);
-				measure_map_.push_back(std::pair<uint_t, uint_t>((uint_t)op->qubits[0], (uint_t)op->clbits[0]));
-				qk_circuit_instruction_clear(op);
+		// instruction indices of the new circuit do not match recorded unitaries
+		unitary_ops_ = std::make_shared<std::vector<std::pair<uint_t, std::shared_ptr<const std::vector<complex_t>>>>>();
+
+		qubit_map_ = std::make_shared<reg_t>(map.begin(), map.end());
+		op_start_times_ = nullptr;
+		duration_ = 0;
+
+		// get measured qubits, hash, metrics and parameters of instructions of the new circuit
+		unshare(measure_map_);
+		ops_fingerprint_ = Fingerprint();
+		hashable_ = true;
+		metrics_ = std::make_shared<CircuitMetrics>();
+		parameter_table_ = std::make_shared<ParameterTable>();
+		uint_t index = 0;
+		for (auto inst : instructions()) {
+			if (inst.kind() == QkOperationKind_Measure) {
+				measure_map_->push_back(std::pair<uint_t, uint_t>((uint_t)inst.qubits()[0], (uint_t)inst.clbits()[0]));
+			} else if (inst.kind() == QkOperationKind_Unitary) {
+				// matrices can not be read from the C-API
+				hashable_ = false;
+			}
+			const QkCircuitInstruction &op = inst.instruction();
+			record_operation(inst.kind(), op.name, inst.gate_info(), op.qubits, op.num_qubits, op.clbits, op.num_clbits);
+			ops_fingerprint_.add((uint_t)op.num_params);
+			for (uint_t i = 0; i < op.num_params; i++) {
+				record_param(op.params[i], index, i);
 			}
+			index++;
 		}
 	}
 
@@ -312,22 +406,60 @@ public:
 	/// @return qubit mapping
 	const reg_t &get_qubit_map(void)
 	{
-		return qubit_map_;
+		return *qubit_map_;
+	}
+
+	/// @brief Set start times of instructions
+	/// @details Set by the scheduling stage of the transpiler. Start times are
+	///          not updated when the circuit is modified.
+	/// @param times start time of each instruction in units of dt
+	/// @param duration duration of the circuit in units of dt
+	void set_op_start_times(const reg_t &times, const uint_t duration)
+	{
+		op_start_times_ = std::make_shared<const reg_t>(times);
+		duration_ = duration;
+	}
+
+	/// @brief Return start times of instructions
+	/// @return start time of each instruction in units of dt (empty if the circuit is not scheduled)
+	const reg_t &op_start_times(void) const
+	{
+		static const reg_t empty;
+		if (!op_start_times_) {
+			return empty;
+		}
+		return *op_start_times_;
+	}
+
+	/// @brief Return if the circuit is scheduled
+	/// @return true if start times are set
+	bool is_scheduled(void) const
+	{
+		return op_start_times_ != nullptr;
+	}
+
+	/// @brief Return duration of the scheduled circuit
+	/// @return duration in units of dt (0 if the circuit is not scheduled)
+	uint_t duration(void) const
+	{
+		return duration_;
 	}
 
 	/// @brief get qubits to be measured
 	/// @return a set of qubits
 	std::vector<std::pair<uint_t, uint_t>> &get_measure_map(void)
 	{
-		return measure_map_;
+		unshare(measure_map_);
+		return *measure_map_;
 	}
 
 	/// @brief set global phase
 	/// @param phase global phase value
 	void global_phase(const double phase)
 	{
+		detach();
 		global_phase_ = phase;
-		qk_circuit_gate(rust_circuit_.get(), QkGate_GlobalPhase, nullptr, &global_phase_);
+		add_gate(QkGate_GlobalPhase, nullptr, &global_phase_);
 	}
 
 	/// @brief Apply HGate
@@ -336,7 +468,21 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_H, qubits, nullptr);
+		add_gate(QkGate_H, qubits, nullptr);
+	}
+
+	/// @brief Apply HGate to each of qubits
+	/// @param qubits The qubits to apply the gate to.
+	void h(const reg_t &qubits)
+	{
+		broadcast_gate(QkGate_H, qubits, nullptr);
+	}
+
+	/// @brief Apply HGate to each qubit of a register
+	/// @param qreg The register to apply the gate to.
+	void h(QuantumRegister &qreg)
+	{
+		broadcast_gate(QkGate_H, register_qubits(qreg), nullptr);
 	}
 
 	/// @brief Apply IGate
@@ -345,7 +491,21 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_I, qubits, nullptr);
+		add_gate(QkGate_I, qubits, nullptr);
+	}
+
+	/// @brief Apply IGate to each of qubits
+	/// @param qubits The qubits to apply the gate to.
+	void i(const reg_t &qubits)
+	{
+		broadcast_gate(QkGate_I, qubits, nullptr);
+	}
+
+	/// @brief Apply IGate to each qubit of a register
+	/// @param qreg The register to apply the gate to.
+	void i(QuantumRegister &qreg)
+	{
+		broadcast_gate(QkGate_I, register_qubits(qreg), nullptr);
 	}
 
 	/// @brief Apply XGate
@@ -354,7 +514,21 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_X, qubits, nullptr);
+		add_gate(QkGate_X, qubits, nullptr);
+	}
+
+	/// @brief Apply XGate to each of qubits
+	/// @param qubits The qubits to apply the gate to.
+	void x(const reg_t &qubits)
+	{
+		broadcast_gate(QkGate_X, qubits, nullptr);
+	}
+
+	/// @brief Apply XGate to each qubit of a register
+	/// @param qreg The register to apply the gate to.
+	void x(QuantumRegister &qreg)
+	{
+		broadcast_gate(QkGate_X, register_qubits(qreg), nullptr);
 	}
 
 	/// @brief Apply YGate
@@ -363,7 +537,21 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_Y, qubits, nullptr);
+		add_gate(QkGate_Y, qubits, nullptr);
+	}
+
+	/// @brief Apply YGate to each of qubits
+	/// @param qubits The qubits to apply the gate to.
+	void y(const reg_t &qubits)
+	{
+		broadcast_gate(QkGate_Y, qubits, nullptr);
+	}
+
+	/// @brief Apply YGate to each qubit of a register
+	/// @param qreg The register to apply the gate to.
+	void y(QuantumRegister &qreg)
+	{
+		broadcast_gate(QkGate_Y, register_qubits(qreg), nullptr);
 	}
 
 	/// @brief Apply ZGate
@@ -372,7 +560,21 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_Z, qubits, nullptr);
+		add_gate(QkGate_Z, qubits, nullptr);
+	}
+
+	/// @brief Apply ZGate to each of qubits
+	/// @param qubits The qubits to apply the gate to.
+	void z(const reg_t &qubits)
+	{
+		broadcast_gate(QkGate_Z, qubits, nullptr);
+	}
+
+	/// @brief Apply ZGate to each qubit of a register
+	/// @param qreg The register to apply the gate to.
+	void z(QuantumRegister &qreg)
+	{
+		broadcast_gate(QkGate_Z, register_qubits(qreg), nullptr);
 	}
 
 	/// @brief Apply PhaseGate
@@ -382,7 +584,7 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_Phase, qubits, &phase);
+		add_gate(QkGate_Phase, qubits, &phase);
 	}
 
 	/// @brief Apply PhaseGate
@@ -391,9 +593,43 @@ public:
 	void p(const Parameter &phase, const uint_t qubit)
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit};
-		QkParam* params[] = {phase.qiskit_param_.get()};
+		const Parameter* params[] = {&phase};
 		pre_add_gate();
-		qk_circuit_parameterized_gate(rust_circuit_.get(), QkGate_Phase, qubits, params);
+		add_parameterized_gate(QkGate_Phase, qubits, params);
+	}
+
+	/// @brief Apply PhaseGate to each of qubits
+	/// @param phase Phase.
+	/// @param qubits The qubits to apply the gate to.
+	void p(const double phase, const reg_t &qubits)
+	{
+		broadcast_gate(QkGate_Phase, qubits, &phase);
+	}
+
+	/// @brief Apply PhaseGate to each qubit of a register
+	/// @param phase Phase.
+	/// @param qreg The register to apply the gate to.
+	void p(const double phase, QuantumRegister &qreg)
+	{
+		broadcast_gate(QkGate_Phase, register_qubits(qreg), &phase);
+	}
+
+	/// @brief Apply PhaseGate to each of qubits
+	/// @param phase Phase.
+	/// @param qubits The qubits to apply the gate to.
+	void p(const Parameter &phase, const reg_t &qubits)
+	{
+		const Parameter* params[] = {&phase};
+		broadcast_parameterized_gate(QkGate_Phase, qubits, params);
+	}
+
+	/// @brief Apply PhaseGate to each qubit of a register
+	/// @param phase Phase.
+	/// @param qreg The register to apply the gate to.
+	void p(const Parameter &phase, QuantumRegister &qreg)
+	{
+		const Parameter* params[] = {&phase};
+		broadcast_parameterized_gate(QkGate_Phase, register_qubits(qreg), params);
 	}
 
 	/// @brief Apply RGate
@@ -405,7 +641,7 @@ public:
 		std::uint32_t qubits[] = {(std::uint32_t)qubit};
 		double params[] = {theta, phi};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_R, qubits, params);
+		add_gate(QkGate_R, qubits, params);
 	}
 
 	/// @brief Apply RGate
@@ -415,9 +651,49 @@ public:
 	void r(const Parameter &theta, const Parameter &phi, const uint_t qubit)
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit};
-		QkParam* params[] = {theta.qiskit_param_.get(), phi.qiskit_param_.get()};
+		const Parameter* params[] = {&theta, &phi};
 		pre_add_gate();
-		qk_circuit_parameterized_gate(rust_circuit_.get(), QkGate_R, qubits, params);
+		add_parameterized_gate(QkGate_R, qubits, params);
+	}
+
+	/// @brief Apply RGate to each of qubits
+	/// @param theta The angle of the rotation.
+	/// @param phi The angle of the axis of rotation in the x-y plane.
+	/// @param qubits The qubits to apply the gate to.
+	void r(const double theta, const double phi, const reg_t &qubits)
+	{
+		double params[] = {theta, phi};
+		broadcast_gate(QkGate_R, qubits, params);
+	}
+
+	/// @brief Apply RGate to each qubit of a register
+	/// @param theta The angle of the rotation.
+	/// @param phi The angle of the axis of rotation in the x-y plane.
+	/// @param qreg The register to apply the gate to.
+	void r(const double theta, const double phi, QuantumRegister &qreg)
+	{
+		double params[] = {theta, phi};
+		broadcast_gate(QkGate_R, register_qubits(qreg), params);
+	}
+
+	/// @brief Apply RGate to each of qubits
+	/// @param theta The angle of the rotation.
+	/// @param phi The angle of the axis of rotation in the x-y plane.
+	/// @param qubits The qubits to apply the gate to.
+	void r(const Parameter &theta, const Parameter &phi, const reg_t &qubits)
+	{
+		const Parameter* params[] = {&theta, &phi};
+		broadcast_parameterized_gate(QkGate_R, qubits, params);
+	}
+
+	/// @brief Apply RGate to each qubit of a register
+	/// @param theta The angle of the rotation.
+	/// @param phi The angle of the axis of rotation in the x-y plane.
+	/// @param qreg The register to apply the gate to.
+	void r(const Parameter &theta, const Parameter &phi, QuantumRegister &qreg)
+	{
+		const Parameter* params[] = {&theta, &phi};
+		broadcast_parameterized_gate(QkGate_R, register_qubits(qreg), params);
 	}
 
 	/// @brief Apply RXGate
@@ -427,7 +703,7 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_RX, qubits, &theta);
+		add_gate(QkGate_RX, qubits, &theta);
 	}
 
 	/// @brief Apply RXGate
@@ -436,9 +712,43 @@ public:
 	void rx(const Parameter &theta, const uint_t qubit)
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit};
-		QkParam* params[] = {theta.qiskit_param_.get()};
+		const Parameter* params[] = {&theta};
 		pre_add_gate();
-		qk_circuit_parameterized_gate(rust_circuit_.get(), QkGate_RX, qubits, params);
+		add_parameterized_gate(QkGate_RX, qubits, params);
+	}
+
+	/// @brief Apply RXGate to each of qubits
+	/// @param theta The angle of the rotation.
+	/// @param qubits The qubits to apply the gate to.
+	void rx(const double theta, const reg_t &qubits)
+	{
+		broadcast_gate(QkGate_RX, qubits, &theta);
+	}
+
+	/// @brief Apply RXGate to each qubit of a register
+	/// @param theta The angle of the rotation.
+	/// @param qreg The register to apply the gate to.
+	void rx(const double theta, QuantumRegister &qreg)
+	{
+		broadcast_gate(QkGate_RX, register_qubits(qreg), &theta);
+	}
+
+	/// @brief Apply RXGate to each of qubits
+	/// @param theta The angle of the rotation.
+	/// @param qubits The qubits to apply the gate to.
+	void rx(const Parameter &theta, const reg_t &qubits)
+	{
+		const Parameter* params[] = {&theta};
+		broadcast_parameterized_gate(QkGate_RX, qubits, params);
+	}
+
+	/// @brief Apply RXGate to each qubit of a register
+	/// @param theta The angle of the rotation.
+	/// @param qreg The register to apply the gate to.
+	void rx(const Parameter &theta, QuantumRegister &qreg)
+	{
+		const Parameter* params[] = {&theta};
+		broadcast_parameterized_gate(QkGate_RX, register_qubits(qreg), params);
 	}
 
 	/// @brief Apply RYGate
@@ -448,7 +758,7 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_RY, qubits, &theta);
+		add_gate(QkGate_RY, qubits, &theta);
 	}
 
 	/// @brief Apply RYGate
@@ -457,9 +767,43 @@ public:
 	void ry(const Parameter &theta, const uint_t qubit)
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit};
-		QkParam* params[] = {theta.qiskit_param_.get()};
+		const Parameter* params[] = {&theta};
 		pre_add_gate();
-		qk_circuit_parameterized_gate(rust_circuit_.get(), QkGate_RY, qubits, params);
+		add_parameterized_gate(QkGate_RY, qubits, params);
+	}
+
+	/// @brief Apply RYGate to each of qubits
+	/// @param theta The angle of the rotation.
+	/// @param qubits The qubits to apply the gate to.
+	void ry(const double theta, const reg_t &qubits)
+	{
+		broadcast_gate(QkGate_RY, qubits, &theta);
+	}
+
+	/// @brief Apply RYGate to each qubit of a register
+	/// @param theta The angle of the rotation.
+	/// @param qreg The register to apply the gate to.
+	void ry(const double theta, QuantumRegister &qreg)
+	{
+		broadcast_gate(QkGate_RY, register_qubits(qreg), &theta);
+	}
+
+	/// @brief Apply RYGate to each of qubits
+	/// @param theta The angle of the rotation.
+	/// @param qubits The qubits to apply the gate to.
+	void ry(const Parameter &theta, const reg_t &qubits)
+	{
+		const Parameter* params[] = {&theta};
+		broadcast_parameterized_gate(QkGate_RY, qubits, params);
+	}
+
+	/// @brief Apply RYGate to each qubit of a register
+	/// @param theta The angle of the rotation.
+	/// @param qreg The register to apply the gate to.
+	void ry(const Parameter &theta, QuantumRegister &qreg)
+	{
+		const Parameter* params[] = {&theta};
+		broadcast_parameterized_gate(QkGate_RY, register_qubits(qreg), params);
 	}
 
 	/// @brief Apply RZGate
@@ -469,7 +813,7 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_RZ, qubits, &theta);
+		add_gate(QkGate_RZ, qubits, &theta);
 	}
 
 	/// @brief Apply RZGate
@@ -478,9 +822,43 @@ public:
 	void rz(const Parameter &theta, const uint_t qubit)
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit};
-		QkParam* params[] = {theta.qiskit_param_.get()};
+		const Parameter* params[] = {&theta};
 		pre_add_gate();
-		qk_circuit_parameterized_gate(rust_circuit_.get(), QkGate_RZ, qubits, params);
+		add_parameterized_gate(QkGate_RZ, qubits, params);
+	}
+
+	/// @brief Apply RZGate to each of qubits
+	/// @param theta The angle of the rotation.
+	/// @param qubits The qubits to apply the gate to.
+	void rz(const double theta, const reg_t &qubits)
+	{
+		broadcast_gate(QkGate_RZ, qubits, &theta);
+	}
+
+	/// @brief Apply RZGate to each qubit of a register
+	/// @param theta The angle of the rotation.
+	/// @param qreg The register to apply the gate to.
+	void rz(const double theta, QuantumRegister &qreg)
+	{
+		broadcast_gate(QkGate_RZ, register_qubits(qreg), &theta);
+	}
+
+	/// @brief Apply RZGate to each of qubits
+	/// @param theta The angle of the rotation.
+	/// @param qubits The qubits to apply the gate to.
+	void rz(const Parameter &theta, const reg_t &qubits)
+	{
+		const Parameter* params[] = {&theta};
+		broadcast_parameterized_gate(QkGate_RZ, qubits, params);
+	}
+
+	/// @brief Apply RZGate to each qubit of a register
+	/// @param theta The angle of the rotation.
+	/// @param qreg The register to apply the gate to.
+	void rz(const Parameter &theta, QuantumRegister &qreg)
+	{
+		const Parameter* params[] = {&theta};
+		broadcast_parameterized_gate(QkGate_RZ, register_qubits(qreg), params);
 	}
 
 	/// @brief Apply SGate
@@ -489,7 +867,21 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_S, qubits, nullptr);
+		add_gate(QkGate_S, qubits, nullptr);
+	}
+
+	/// @brief Apply SGate to each of qubits
+	/// @param qubits The qubits to apply the gate to.
+	void s(const reg_t &qubits)
+	{
+		broadcast_gate(QkGate_S, qubits, nullptr);
+	}
+
+	/// @brief Apply SGate to each qubit of a register
+	/// @param qreg The register to apply the gate to.
+	void s(QuantumRegister &qreg)
+	{
+		broadcast_gate(QkGate_S, register_qubits(qreg), nullptr);
 	}
 
 	/// @brief Apply SdgGate
@@ -498,7 +890,21 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_Sdg, qubits, nullptr);
+		add_gate(QkGate_Sdg, qubits, nullptr);
+	}
+
+	/// @brief Apply SdgGate to each of qubits
+	/// @param qubits The qubits to apply the gate to.
+	void sdg(const reg_t &qubits)
+	{
+		broadcast_gate(QkGate_Sdg, qubits, nullptr);
+	}
+
+	/// @brief Apply SdgGate to each qubit of a register
+	/// @param qreg The register to apply the gate to.
+	void sdg(QuantumRegister &qreg)
+	{
+		broadcast_gate(QkGate_Sdg, register_qubits(qreg), nullptr);
 	}
 
 	/// @brief Apply SXGate
@@ -507,7 +913,21 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_SX, qubits, nullptr);
+		add_gate(QkGate_SX, qubits, nullptr);
+	}
+
+	/// @brief Apply SXGate to each of qubits
+	/// @param qubits The qubits to apply the gate to.
+	void sx(const reg_t &qubits)
+	{
+		broadcast_gate(QkGate_SX, qubits, nullptr);
+	}
+
+	/// @brief Apply SXGate to each qubit of a register
+	/// @param qreg The register to apply the gate to.
+	void sx(QuantumRegister &qreg)
+	{
+		broadcast_gate(QkGate_SX, register_qubits(qreg), nullptr);
 	}
 
 	/// @brief Apply SXdgGate
@@ -516,7 +936,21 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_SXdg, qubits, nullptr);
+		add_gate(QkGate_SXdg, qubits, nullptr);
+	}
+
+	/// @brief Apply SXdgGate to each of qubits
+	/// @param qubits The qubits to apply the gate to.
+	void sxdg(const reg_t &qubits)
+	{
+		broadcast_gate(QkGate_SXdg, qubits, nullptr);
+	}
+
+	/// @brief Apply SXdgGate to each qubit of a register
+	/// @param qreg The register to apply the gate to.
+	void sxdg(QuantumRegister &qreg)
+	{
+		broadcast_gate(QkGate_SXdg, register_qubits(qreg), nullptr);
 	}
 
 	/// @brief Apply TGate
@@ -525,7 +959,21 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_T, qubits, nullptr);
+		add_gate(QkGate_T, qubits, nullptr);
+	}
+
+	/// @brief Apply TGate to each of qubits
+	/// @param qubits The qubits to apply the gate to.
+	void t(const reg_t &qubits)
+	{
+		broadcast_gate(QkGate_T, qubits, nullptr);
+	}
+
+	/// @brief Apply TGate to each qubit of a register
+	/// @param qreg The register to apply the gate to.
+	void t(QuantumRegister &qreg)
+	{
+		broadcast_gate(QkGate_T, register_qubits(qreg), nullptr);
 	}
 
 	/// @brief Apply TdgGate
@@ -534,7 +982,21 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_Tdg, qubits, nullptr);
+		add_gate(QkGate_Tdg, qubits, nullptr);
+	}
+
+	/// @brief Apply TdgGate to each of qubits
+	/// @param qubits The qubits to apply the gate to.
+	void tdg(const reg_t &qubits)
+	{
+		broadcast_gate(QkGate_Tdg, qubits, nullptr);
+	}
+
+	/// @brief Apply TdgGate to each qubit of a register
+	/// @param qreg The register to apply the gate to.
+	void tdg(QuantumRegister &qreg)
+	{
+		broadcast_gate(QkGate_Tdg, register_qubits(qreg), nullptr);
 	}
 
 	/// @brief Apply UGate
@@ -547,7 +1009,7 @@ public:
 		std::uint32_t qubits[] = {(std::uint32_t)qubit};
 		double params[] = {theta, phi, lam};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_U, qubits, params);
+		add_gate(QkGate_U, qubits, params);
 	}
 
 	/// @brief Apply UGate
@@ -558,9 +1020,53 @@ public:
 	void u(const Parameter &theta, const Parameter &phi, const Parameter &lam, const uint_t qubit)
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit};
-		QkParam* params[] = {theta.qiskit_param_.get(), phi.qiskit_param_.get(), lam.qiskit_param_.get()};
+		const Parameter* params[] = {&theta, &phi, &lam};
 		pre_add_gate();
-		qk_circuit_parameterized_gate(rust_circuit_.get(), QkGate_U, qubits, params);
+		add_parameterized_gate(QkGate_U, qubits, params);
+	}
+
+	/// @brief Apply UGate to each of qubits
+	/// @param theta The theta rotation angle of the gate.
+	/// @param phi The phi rotation angle of the gate.
+	/// @param lam The lam rotation angle of the gate.
+	/// @param qubits The qubits to apply the gate to.
+	void u(const double theta, const double phi, const double lam, const reg_t &qubits)
+	{
+		double params[] = {theta, phi, lam};
+		broadcast_gate(QkGate_U, qubits, params);
+	}
+
+	/// @brief Apply UGate to each qubit of a register
+	/// @param theta The theta rotation angle of the gate.
+	/// @param phi The phi rotation angle of the gate.
+	/// @param lam The lam rotation angle of the gate.
+	/// @param qreg The register to apply the gate to.
+	void u(const double theta, const double phi, const double lam, QuantumRegister &qreg)
+	{
+		double params[] = {theta, phi, lam};
+		broadcast_gate(QkGate_U, register_qubits(qreg), params);
+	}
+
+	/// @brief Apply UGate to each of qubits
+	/// @param theta The theta rotation angle of the gate.
+	/// @param phi The phi rotation angle of the gate.
+	/// @param lam The lam rotation angle of the gate.
+	/// @param qubits The qubits to apply the gate to.
+	void u(const Parameter &theta, const Parameter &phi, const Parameter &lam, const reg_t &qubits)
+	{
+		const Parameter* params[] = {&theta, &phi, &lam};
+		broadcast_parameterized_gate(QkGate_U, qubits, params);
+	}
+
+	/// @brief Apply UGate to each qubit of a register
+	/// @param theta The theta rotation angle of the gate.
+	/// @param phi The phi rotation angle of the gate.
+	/// @param lam The lam rotation angle of the gate.
+	/// @param qreg The register to apply the gate to.
+	void u(const Parameter &theta, const Parameter &phi, const Parameter &lam, QuantumRegister &qreg)
+	{
+		const Parameter* params[] = {&theta, &phi, &lam};
+		broadcast_parameterized_gate(QkGate_U, register_qubits(qreg), params);
 	}
 
 	/// @brief Apply U1Gate
@@ -570,7 +1076,7 @@ public:
 		std::uint32_t qubits[] = {(std::uint32_t)qubit};
 		double params[] = {theta};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_U1, qubits, params);
+		add_gate(QkGate_U1, qubits, params);
 	}
 
 	/// @brief Apply U1Gate
@@ -579,9 +1085,43 @@ public:
 	void u1(const Parameter &theta, const uint_t qubit)
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit};
-		QkParam* params[] = {theta.qiskit_param_.get()};
+		const Parameter* params[] = {&theta};
 		pre_add_gate();
-		qk_circuit_parameterized_gate(rust_circuit_.get(), QkGate_U1, qubits, params);
+		add_parameterized_gate(QkGate_U1, qubits, params);
+	}
+
+	/// @brief Apply U1Gate to each of qubits
+	/// @param theta The theta rotation angle of the gate.
+	/// @param qubits The qubits to apply the gate to.
+	void u1(const double theta, const reg_t &qubits)
+	{
+		broadcast_gate(QkGate_U1, qubits, &theta);
+	}
+
+	/// @brief Apply U1Gate to each qubit of a register
+	/// @param theta The theta rotation angle of the gate.
+	/// @param qreg The register to apply the gate to.
+	void u1(const double theta, QuantumRegister &qreg)
+	{
+		broadcast_gate(QkGate_U1, register_qubits(qreg), &theta);
+	}
+
+	/// @brief Apply U1Gate to each of qubits
+	/// @param theta The theta rotation angle of the gate.
+	/// @param qubits The qubits to apply the gate to.
+	void u1(const Parameter &theta, const reg_t &qubits)
+	{
+		const Parameter* params[] = {&theta};
+		broadcast_parameterized_gate(QkGate_U1, qubits, params);
+	}
+
+	/// @brief Apply U1Gate to each qubit of a register
+	/// @param theta The theta rotation angle of the gate.
+	/// @param qreg The register to apply the gate to.
+	void u1(const Parameter &theta, QuantumRegister &qreg)
+	{
+		const Parameter* params[] = {&theta};
+		broadcast_parameterized_gate(QkGate_U1, register_qubits(qreg), params);
 	}
 
 	/// @brief Apply U2Gate
@@ -593,7 +1133,7 @@ public:
 		std::uint32_t qubits[] = {(std::uint32_t)qubit};
 		double params[] = {phi, lam};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_U2, qubits, params);
+		add_gate(QkGate_U2, qubits, params);
 	}
 
 	/// @brief Apply U2Gate
@@ -603,9 +1143,49 @@ public:
 	void u2(const Parameter &phi, const Parameter &lam, const uint_t qubit)
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit};
-		QkParam* params[] = {phi.qiskit_param_.get(), lam.qiskit_param_.get()};
+		const Parameter* params[] = {&phi, &lam};
 		pre_add_gate();
-		qk_circuit_parameterized_gate(rust_circuit_.get(), QkGate_U2, qubits, params);
+		add_parameterized_gate(QkGate_U2, qubits, params);
+	}
+
+	/// @brief Apply U2Gate to each of qubits
+	/// @param phi The phi rotation angle of the gate.
+	/// @param lam The lam rotation angle of the gate.
+	/// @param qubits The qubits to apply the gate to.
+	void u2(const double phi, const double lam, const reg_t &qubits)
+	{
+		double params[] = {phi, lam};
+		broadcast_gate(QkGate_U2, qubits, params);
+	}
+
+	/// @brief Apply U2Gate to each qubit of a register
+	/// @param phi The phi rotation angle of the gate.
+	/// @param lam The lam rotation angle of the gate.
+	/// @param qreg The register to apply the gate to.
+	void u2(const double phi, const double lam, QuantumRegister &qreg)
+	{
+		double params[] = {phi, lam};
+		broadcast_gate(QkGate_U2, register_qubits(qreg), params);
+	}
+
+	/// @brief Apply U2Gate to each of qubits
+	/// @param phi The phi rotation angle of the gate.
+	/// @param lam The lam rotation angle of the gate.
+	/// @param qubits The qubits to apply the gate to.
+	void u2(const Parameter &phi, const Parameter &lam, const reg_t &qubits)
+	{
+		const Parameter* params[] = {&phi, &lam};
+		broadcast_parameterized_gate(QkGate_U2, qubits, params);
+	}
+
+	/// @brief Apply U2Gate to each qubit of a register
+	/// @param phi The phi rotation angle of the gate.
+	/// @param lam The lam rotation angle of the gate.
+	/// @param qreg The register to apply the gate to.
+	void u2(const Parameter &phi, const Parameter &lam, QuantumRegister &qreg)
+	{
+		const Parameter* params[] = {&phi, &lam};
+		broadcast_parameterized_gate(QkGate_U2, register_qubits(qreg), params);
 	}
 
 	/// @brief Apply U3Gate
@@ -618,7 +1198,7 @@ public:
 		std::uint32_t qubits[] = {(std::uint32_t)qubit};
 		double params[] = {theta, phi, lam};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_U3, qubits, params);
+		add_gate(QkGate_U3, qubits, params);
 	}
 
 	/// @brief Apply U3Gate
@@ -629,9 +1209,53 @@ public:
 	void u3(const Parameter &theta, const Parameter &phi, const Parameter &lam, const uint_t qubit)
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit};
-		QkParam* params[] = {theta.qiskit_param_.get(), phi.qiskit_param_.get(), lam.qiskit_param_.get()};
+		const Parameter* params[] = {&theta, &phi, &lam};
 		pre_add_gate();
-		qk_circuit_parameterized_gate(rust_circuit_.get(), QkGate_U3, qubits, params);
+		add_parameterized_gate(QkGate_U3, qubits, params);
+	}
+
+	/// @brief Apply U3Gate to each of qubits
+	/// @param theta The theta rotation angle of the gate.
+	/// @param phi The phi rotation angle of the gate.
+	/// @param lam The lam rotation angle of the gate.
+	/// @param qubits The qubits to apply the gate to.
+	void u3(const double theta, const double phi, const double lam, const reg_t &qubits)
+	{
+		double params[] = {theta, phi, lam};
+		broadcast_gate(QkGate_U3, qubits, params);
+	}
+
+	/// @brief Apply U3Gate to each qubit of a register
+	/// @param theta The theta rotation angle of the gate.
+	/// @param phi The phi rotation angle of the gate.
+	/// @param lam The lam rotation angle of the gate.
+	/// @param qreg The register to apply the gate to.
+	void u3(const double theta, const double phi, const double lam, QuantumRegister &qreg)
+	{
+		double params[] = {theta, phi, lam};
+		broadcast_gate(QkGate_U3, register_qubits(qreg), params);
+	}
+
+	/// @brief Apply U3Gate to each of qubits
+	/// @param theta The theta rotation angle of the gate.
+	/// @param phi The phi rotation angle of the gate.
+	/// @param lam The lam rotation angle of the gate.
+	/// @param qubits The qubits to apply the gate to.
+	void u3(const Parameter &theta, const Parameter &phi, const Parameter &lam, const reg_t &qubits)
+	{
+		const Parameter* params[] = {&theta, &phi, &lam};
+		broadcast_parameterized_gate(QkGate_U3, qubits, params);
+	}
+
+	/// @brief Apply U3Gate to each qubit of a register
+	/// @param theta The theta rotation angle of the gate.
+	/// @param phi The phi rotation angle of the gate.
+	/// @param lam The lam rotation angle of the gate.
+	/// @param qreg The register to apply the gate to.
+	void u3(const Parameter &theta, const Parameter &phi, const Parameter &lam, QuantumRegister &qreg)
+	{
+		const Parameter* params[] = {&theta, &phi, &lam};
+		broadcast_parameterized_gate(QkGate_U3, register_qubits(qreg), params);
 	}
 
 	/// @brief Apply unitary gate specified by unitary to qubits
@@ -644,7 +1268,8 @@ public:
 		for (uint_t i = 0; i < qubits.size(); i++)
 			qubits32[i] = (std::uint32_t)qubits[i];
 
-		qk_circuit_unitary(rust_circuit_.get(), (const QkComplex64 *)unitary.data(), qubits32.data(), (std::uint32_t)qubits.size(), true);
+		// C-API can not return the matrix, so keep it here to be used in compose
+		add_unitary(std::make_shared<const std::vector<complex_t>>(unitary), qubits32.data(), (std::uint32_t)qubits.size(), true);
 	}
 
 	/// @brief Apply CHGate
@@ -654,7 +1279,7 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)cqubit, (std::uint32_t)tqubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_CH, qubits, nullptr);
+		add_gate(QkGate_CH, qubits, nullptr);
 	}
 
 	/// @brief Apply CXGate
@@ -664,7 +1289,7 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)cqubit, (std::uint32_t)tqubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_CX, qubits, nullptr);
+		add_gate(QkGate_CX, qubits, nullptr);
 	}
 
 	/// @brief Apply CYGate
@@ -674,7 +1299,7 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)cqubit, (std::uint32_t)tqubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_CY, qubits, nullptr);
+		add_gate(QkGate_CY, qubits, nullptr);
 	}
 
 	/// @brief Apply CZGate
@@ -684,7 +1309,7 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)cqubit, (std::uint32_t)tqubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_CZ, qubits, nullptr);
+		add_gate(QkGate_CZ, qubits, nullptr);
 	}
 
 	/// @brief Apply DCXGate
@@ -694,7 +1319,7 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit1, (std::uint32_t)qubit2};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_DCX, qubits, nullptr);
+		add_gate(QkGate_DCX, qubits, nullptr);
 	}
 
 	/// @brief Apply ECRGate
@@ -704,7 +1329,7 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)cqubit, (std::uint32_t)tqubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_ECR, qubits, nullptr);
+		add_gate(QkGate_ECR, qubits, nullptr);
 	}
 
 	/// @brief Apply SwapGate
@@ -714,7 +1339,7 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit1, (std::uint32_t)qubit2};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_Swap, qubits, nullptr);
+		add_gate(QkGate_Swap, qubits, nullptr);
 	}
 
 	/// @brief Apply iSwapGate
@@ -724,7 +1349,7 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit1, (std::uint32_t)qubit2};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_ISwap, qubits, nullptr);
+		add_gate(QkGate_ISwap, qubits, nullptr);
 	}
 
 	/// @brief Apply controlled PhaseGate
@@ -735,7 +1360,7 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)cqubit, (std::uint32_t)tqubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_CPhase, qubits, &phase);
+		add_gate(QkGate_CPhase, qubits, &phase);
 	}
 
 	/// @brief Apply controlled PhaseGate
@@ -745,9 +1370,9 @@ public:
 	void cp(const Parameter &phase, const uint_t cqubit, const uint_t tqubit)
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)cqubit, (std::uint32_t)tqubit};
-		QkParam* params[] = {phase.qiskit_param_.get()};
+		const Parameter* params[] = {&phase};
 		pre_add_gate();
-		qk_circuit_parameterized_gate(rust_circuit_.get(), QkGate_CPhase, qubits, params);
+		add_parameterized_gate(QkGate_CPhase, qubits, params);
 	}
 
 	/// @brief Apply controlled RXGate
@@ -758,7 +1383,7 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)cqubit, (std::uint32_t)tqubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_CRX, qubits, &theta);
+		add_gate(QkGate_CRX, qubits, &theta);
 	}
 
 	/// @brief Apply controlled RXGate
@@ -768,9 +1393,9 @@ public:
 	void crx(const Parameter &theta, const uint_t cqubit, const uint_t tqubit)
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)cqubit, (std::uint32_t)tqubit};
-		QkParam* params[] = {theta.qiskit_param_.get()};
+		const Parameter* params[] = {&theta};
 		pre_add_gate();
-		qk_circuit_parameterized_gate(rust_circuit_.get(), QkGate_CRX, qubits, params);
+		add_parameterized_gate(QkGate_CRX, qubits, params);
 	}
 
 	/// @brief Apply controlled RYGate
@@ -781,7 +1406,7 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)cqubit, (std::uint32_t)tqubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_CRY, qubits, &theta);
+		add_gate(QkGate_CRY, qubits, &theta);
 	}
 
 	/// @brief Apply controlled RYGate
@@ -791,9 +1416,9 @@ public:
 	void cry(const Parameter &theta, const uint_t cqubit, const uint_t tqubit)
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)cqubit, (std::uint32_t)tqubit};
-		QkParam* params[] = {theta.qiskit_param_.get()};
+		const Parameter* params[] = {&theta};
 		pre_add_gate();
-		qk_circuit_parameterized_gate(rust_circuit_.get(), QkGate_CRY, qubits, params);
+		add_parameterized_gate(QkGate_CRY, qubits, params);
 	}
 
 	/// @brief Apply controlled RZGate
@@ -804,7 +1429,7 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)cqubit, (std::uint32_t)tqubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_CRZ, qubits, &theta);
+		add_gate(QkGate_CRZ, qubits, &theta);
 	}
 
 	/// @brief Apply controlled RZGate
@@ -814,9 +1439,9 @@ public:
 	void crz(const Parameter &theta, const uint_t cqubit, const uint_t tqubit)
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)cqubit, (std::uint32_t)tqubit};
-		QkParam* params[] = {theta.qiskit_param_.get()};
+		const Parameter* params[] = {&theta};
 		pre_add_gate();
-		qk_circuit_parameterized_gate(rust_circuit_.get(), QkGate_CRZ, qubits, params);
+		add_parameterized_gate(QkGate_CRZ, qubits, params);
 	}
 
 	/// @brief Apply CSGate
@@ -826,7 +1451,7 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)cqubit, (std::uint32_t)tqubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_CS, qubits, nullptr);
+		add_gate(QkGate_CS, qubits, nullptr);
 	}
 
 	/// @brief Apply CSdgGate
@@ -836,7 +1461,7 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)cqubit, (std::uint32_t)tqubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_CSdg, qubits, nullptr);
+		add_gate(QkGate_CSdg, qubits, nullptr);
 	}
 
 	/// @brief Apply CSXGate
@@ -846,7 +1471,7 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)cqubit, (std::uint32_t)tqubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_CSX, qubits, nullptr);
+		add_gate(QkGate_CSX, qubits, nullptr);
 	}
 
 	/// @brief Apply CUGate
@@ -856,11 +1481,23 @@ public:
 	/// @param cqubit The qubit used as the control
 	/// @param tqubit The qubit targeted by the gate
 	void cu(const double theta, const double phi, const double lam, const uint_t cqubit, const uint_t tqubit)
+	{
+		cu(theta, phi, lam, 0.0, cqubit, tqubit);
+	}
+
+	/// @brief Apply CUGate
+	/// @param theta The theta rotation angle of the gate.
+	/// @param phi The phi rotation angle of the gate.
+	/// @param lam The lam rotation angle of the gate.
+	/// @param gamma The global phase applied of the U gate, if applied.
+	/// @param cqubit The qubit used as the control
+	/// @param tqubit The qubit targeted by the gate
+	void cu(const double theta, const double phi, const double lam, const double gamma, const uint_t cqubit, const uint_t tqubit)
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)cqubit, (std::uint32_t)tqubit};
-		double params[] = {theta, phi, lam};
+		double params[] = {theta, phi, lam, gamma};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_CU, qubits, params);
+		add_gate(QkGate_CU, qubits, params);
 	}
 
 	/// @brief Apply CUGate
@@ -870,11 +1507,23 @@ public:
 	/// @param cqubit The qubit used as the control
 	/// @param tqubit The qubit targeted by the gate
 	void cu(const Parameter &theta, const Parameter &phi, const Parameter &lam, const uint_t cqubit, const uint_t tqubit)
+	{
+		cu(theta, phi, lam, Parameter(0.0), cqubit, tqubit);
+	}
+
+	/// @brief Apply CUGate
+	/// @param theta The theta rotation angle of the gate.
+	/// @param phi The phi rotation angle of the gate.
+	/// @param lam The lam rotation angle of the gate.
+	/// @param gamma The global phase applied of the U gate, if applied.
+	/// @param cqubit The qubit used as the control
+	/// @param tqubit The qubit targeted by the gate
+	void cu(const Parameter &theta, const Parameter &phi, const Parameter &lam, const Parameter &gamma, const uint_t cqubit, const uint_t tqubit)
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)cqubit, (std::uint32_t)tqubit};
-		QkParam* params[] = {theta.qiskit_param_.get(), phi.qiskit_param_.get(), lam.qiskit_param_.get()};
+		const Parameter* params[] = {&theta, &phi, &lam, &gamma};
 		pre_add_gate();
-		qk_circuit_parameterized_gate(rust_circuit_.get(), QkGate_CU, qubits, params);
+		add_parameterized_gate(QkGate_CU, qubits, params);
 	}
 
 	/// @brief Apply CU1Gate
@@ -886,7 +1535,7 @@ public:
 		std::uint32_t qubits[] = {(std::uint32_t)cqubit, (std::uint32_t)tqubit};
 		double params[] = {theta};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_CU1, qubits, params);
+		add_gate(QkGate_CU1, qubits, params);
 	}
 
 	/// @brief Apply CU1Gate
@@ -896,9 +1545,9 @@ public:
 	void cu1(const Parameter &theta, const uint_t cqubit, const uint_t tqubit)
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)cqubit, (std::uint32_t)tqubit};
-		QkParam* params[] = {theta.qiskit_param_.get()};
+		const Parameter* params[] = {&theta};
 		pre_add_gate();
-		qk_circuit_parameterized_gate(rust_circuit_.get(), QkGate_CU1, qubits, params);
+		add_parameterized_gate(QkGate_CU1, qubits, params);
 	}
 
 	/// @brief Apply CU3Gate
@@ -912,7 +1561,7 @@ public:
 		std::uint32_t qubits[] = {(std::uint32_t)cqubit, (std::uint32_t)tqubit};
 		double params[] = {theta, phi, lam};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_CU3, qubits, params);
+		add_gate(QkGate_CU3, qubits, params);
 	}
 
 	/// @brief Apply CU3Gate
@@ -924,9 +1573,9 @@ public:
 	void cu3(const Parameter &theta, const Parameter &phi, const Parameter &lam, const uint_t cqubit, const uint_t tqubit)
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)cqubit, (std::uint32_t)tqubit};
-		QkParam* params[] = {theta.qiskit_param_.get(), phi.qiskit_param_.get(), lam.qiskit_param_.get()};
+		const Parameter* params[] = {&theta, &phi, &lam};
 		pre_add_gate();
-		qk_circuit_parameterized_gate(rust_circuit_.get(), QkGate_CU3, qubits, params);
+		add_parameterized_gate(QkGate_CU3, qubits, params);
 	}
 
 	/// @brief Apply RXXGate
@@ -937,7 +1586,7 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit1, (std::uint32_t)qubit2};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_RXX, qubits, &theta);
+		add_gate(QkGate_RXX, qubits, &theta);
 	}
 
 	/// @brief Apply RXXGate
@@ -947,9 +1596,9 @@ public:
 	void rxx(const Parameter &theta, const uint_t qubit1, const uint_t qubit2)
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit1, (std::uint32_t)qubit2};
-		QkParam* params[] = {theta.qiskit_param_.get()};
+		const Parameter* params[] = {&theta};
 		pre_add_gate();
-		qk_circuit_parameterized_gate(rust_circuit_.get(), QkGate_RXX, qubits, params);
+		add_parameterized_gate(QkGate_RXX, qubits, params);
 	}
 
 	/// @brief Apply RYYGate
@@ -960,7 +1609,7 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit1, (std::uint32_t)qubit2};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_RYY, qubits, &theta);
+		add_gate(QkGate_RYY, qubits, &theta);
 	}
 
 	/// @brief Apply RYYGate
@@ -970,9 +1619,9 @@ public:
 	void ryy(const Parameter &theta, const uint_t qubit1, const uint_t qubit2)
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit1, (std::uint32_t)qubit2};
-		QkParam* params[] = {theta.qiskit_param_.get()};
+		const Parameter* params[] = {&theta};
 		pre_add_gate();
-		qk_circuit_parameterized_gate(rust_circuit_.get(), QkGate_RYY, qubits, params);
+		add_parameterized_gate(QkGate_RYY, qubits, params);
 	}
 
 	/// @brief Apply RZZGate
@@ -983,7 +1632,7 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit1, (std::uint32_t)qubit2};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_RZZ, qubits, &theta);
+		add_gate(QkGate_RZZ, qubits, &theta);
 	}
 
 	/// @brief Apply RZZGate
@@ -993,9 +1642,9 @@ public:
 	void rzz(const Parameter &theta, const uint_t qubit1, const uint_t qubit2)
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit1, (std::uint32_t)qubit2};
-		QkParam* params[] = {theta.qiskit_param_.get()};
+		const Parameter* params[] = {&theta};
 		pre_add_gate();
-		qk_circuit_parameterized_gate(rust_circuit_.get(), QkGate_RZZ, qubits, params);
+		add_parameterized_gate(QkGate_RZZ, qubits, params);
 	}
 
 	/// @brief Apply RZXGate
@@ -1006,7 +1655,7 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit1, (std::uint32_t)qubit2};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_RZX, qubits, &theta);
+		add_gate(QkGate_RZX, qubits, &theta);
 	}
 
 	/// @brief Apply RZXGate
@@ -1016,9 +1665,9 @@ public:
 	void rzx(const Parameter &theta, const uint_t qubit1, const uint_t qubit2)
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit1, (std::uint32_t)qubit2};
-		QkParam* params[] = {theta.qiskit_param_.get()};
+		const Parameter* params[] = {&theta};
 		pre_add_gate();
-		qk_circuit_parameterized_gate(rust_circuit_.get(), QkGate_RZX, qubits, params);
+		add_parameterized_gate(QkGate_RZX, qubits, params);
 	}
 
 	/// @brief Apply XXminusYY
@@ -1031,7 +1680,7 @@ public:
 		std::uint32_t qubits[] = {(std::uint32_t)qubit1, (std::uint32_t)qubit2};
 		double params[] = {theta, beta};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_XXMinusYY, qubits, params);
+		add_gate(QkGate_XXMinusYY, qubits, params);
 	}
 
 	/// @brief Apply XXminusYY
@@ -1042,9 +1691,9 @@ public:
 	void xx_minus_yy(const Parameter &theta, const Parameter &beta, const uint_t qubit1, const uint_t qubit2)
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit1, (std::uint32_t)qubit2};
-		QkParam* params[] = {theta.qiskit_param_.get(), beta.qiskit_param_.get()};
+		const Parameter* params[] = {&theta, &beta};
 		pre_add_gate();
-		qk_circuit_parameterized_gate(rust_circuit_.get(), QkGate_XXMinusYY, qubits, params);
+		add_parameterized_gate(QkGate_XXMinusYY, qubits, params);
 	}
 
 	/// @brief Apply XXplusYY
@@ -1057,7 +1706,7 @@ public:
 		std::uint32_t qubits[] = {(std::uint32_t)qubit1, (std::uint32_t)qubit2};
 		double params[] = {theta, beta};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_XXPlusYY, qubits, params);
+		add_gate(QkGate_XXPlusYY, qubits, params);
 	}
 
 	/// @brief Apply XXplusYY
@@ -1068,9 +1717,9 @@ public:
 	void xx_plus_yy(const Parameter &theta, const Parameter &beta, const uint_t qubit1, const uint_t qubit2)
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)qubit1, (std::uint32_t)qubit2};
-		QkParam* params[] = {theta.qiskit_param_.get(), beta.qiskit_param_.get()};
+		const Parameter* params[] = {&theta, &beta};
 		pre_add_gate();
-		qk_circuit_parameterized_gate(rust_circuit_.get(), QkGate_XXPlusYY, qubits, params);
+		add_parameterized_gate(QkGate_XXPlusYY, qubits, params);
 	}
 
 	/// @brief Apply CCXGate
@@ -1081,7 +1730,7 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)cqubit1, (std::uint32_t)cqubit2, (std::uint32_t)tqubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_CCX, qubits, nullptr);
+		add_gate(QkGate_CCX, qubits, nullptr);
 	}
 
 	/// @brief Apply CCZGate
@@ -1092,7 +1741,7 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)cqubit1, (std::uint32_t)cqubit2, (std::uint32_t)tqubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_CCZ, qubits, nullptr);
+		add_gate(QkGate_CCZ, qubits, nullptr);
 	}
 
 	/// @brief Apply CSwapGate
@@ -1103,7 +1752,7 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)cqubit, (std::uint32_t)qubit1, (std::uint32_t)qubit2};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_CSwap, qubits, nullptr);
+		add_gate(QkGate_CSwap, qubits, nullptr);
 	}
 
 	/// @brief Apply RCCXGate
@@ -1114,7 +1763,7 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)cqubit1, (std::uint32_t)cqubit2, (std::uint32_t)tqubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_RCCX, qubits, nullptr);
+		add_gate(QkGate_RCCX, qubits, nullptr);
 	}
 
 	/// @brief Apply C3XGate
@@ -1126,7 +1775,7 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)cqubit1, (std::uint32_t)cqubit2, (std::uint32_t)cqubit3, (std::uint32_t)tqubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_C3X, qubits, nullptr);
+		add_gate(QkGate_C3X, qubits, nullptr);
 	}
 
 	/// @brief Apply C3SXGate
@@ -1138,7 +1787,7 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)cqubit1, (std::uint32_t)cqubit2, (std::uint32_t)cqubit3, (std::uint32_t)tqubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_C3SX, qubits, nullptr);
+		add_gate(QkGate_C3SX, qubits, nullptr);
 	}
 
 	/// @brief Apply RC3XGate
@@ -1150,7 +1799,7 @@ public:
 	{
 		std::uint32_t qubits[] = {(std::uint32_t)cqubit1, (std::uint32_t)cqubit2, (std::uint32_t)cqubit3, (std::uint32_t)tqubit};
 		pre_add_gate();
-		qk_circuit_gate(rust_circuit_.get(), QkGate_RC3X, qubits, nullptr);
+		add_gate(QkGate_RC3X, qubits, nullptr);
 	}
 
 	// other operations
@@ -1161,8 +1810,36 @@ public:
 	void measure(const uint_t qubit, const uint_t cbit)
 	{
 		pre_add_gate();
-		qk_circuit_measure(rust_circuit_.get(), (std::uint32_t)qubit, (std::uint32_t)cbit);
-		measure_map_.push_back(std::pair<uint_t, uint_t>(qubit, cbit));
+		add_measure((std::uint32_t)qubit, (std::uint32_t)cbit);
+		measure_map_->push_back(std::pair<uint_t, uint_t>(qubit, cbit));
+	}
+
+	/// @brief Measure quantum bits in the Z basis into classical bits
+	/// @details All operands are checked before any measurement is added.
+	/// @param qubits The qubits to measure
+	/// @param clbits The classical bits to place the measurement results in, one for each qubit
+	void measure(const reg_t &qubits, const reg_t &clbits)
+	{
+		if (qubits.size() != clbits.size()) {
+			std::cerr << " QuantumCircuit::measure : " << qubits.size() << " qubits are measured into " << clbits.size() << " clbits" << std::endl;
+			return;
+		}
+		if (!check_qubits(qubits, "measure")) {
+			return;
+		}
+		for (auto c : clbits) {
+			if (c >= num_clbits_) {
+				std::cerr << " QuantumCircuit::measure : clbit " << c << " is out of range" << std::endl;
+				return;
+			}
+		}
+		pre_add_gate();
+		measure_map_->reserve(measure_map_->size() + qubits.size());
+		for (uint_t i = 0; i < qubits.size(); i++) {
+			if (add_measure((std::uint32_t)qubits[i], (std::uint32_t)clbits[i]) == QkExitCode_Success) {
+				measure_map_->push_back(std::pair<uint_t, uint_t>(qubits[i], clbits[i]));
+			}
+		}
 	}
 
 	/// @brief Measure a quantum bit(qreg) in the Z basis into a classical bit(creg)
@@ -1170,15 +1847,16 @@ public:
 	/// @param creg The classical bit to place the measurement result in.
 	void measure(QuantumRegister &qreg, ClassicalRegister &creg)
 	{
-		pre_add_gate();
 		uint_t size = qreg.size();
 		if (size > creg.size())
 			size = creg.size();
-		// TO DO implement multi-bits measure in C-API
+		reg_t qubits(size);
+		reg_t clbits(size);
 		for (uint_t i = 0; i < size; i++) {
-			qk_circuit_measure(rust_circuit_.get(), (std::uint32_t)qreg[i], (std::uint32_t)creg[i]);
-			measure_map_.push_back(std::pair<uint_t, uint_t>(qreg[i], creg[i]));
+			qubits[i] = qreg.base_index() + i;
+			clbits[i] = creg.base_index() + i;
 		}
+		measure(qubits, clbits);
 	}
 
 	/// @brief Reset the quantum bit to their default state
@@ -1186,18 +1864,28 @@ public:
 	void reset(const uint_t qubit)
 	{
 		pre_add_gate();
-		qk_circuit_reset(rust_circuit_.get(), (std::uint32_t)qubit);
+		add_reset((std::uint32_t)qubit);
+	}
+
+	/// @brief Reset quantum bits to their default state
+	/// @details All qubits are checked before any reset is added.
+	/// @param qubits The qubits to reset
+	void reset(const reg_t &qubits)
+	{
+		if (!check_qubits(qubits, "reset")) {
+			return;
+		}
+		pre_add_gate();
+		for (auto q : qubits) {
+			add_reset((std::uint32_t)q);
+		}
 	}
 
 	/// @brief Reset the quantum bit to their default state
 	/// @param qreg The qubit to reset
 	void reset(QuantumRegister &qreg)
 	{
-		pre_add_gate();
-		// TO DO implement multi-bits rest in C-API
-		for (uint_t i = 0; i < qreg.size(); i++) {
-			qk_circuit_reset(rust_circuit_.get(), (std::uint32_t)qreg[i]);
-		}
+		reset(register_qubits(qreg));
 	}
 
 	/// @brief Insert barrier on specified qubit
@@ -1206,7 +1894,7 @@ public:
 	{
 		pre_add_gate();
 		std::uint32_t q = (std::uint32_t)qubit;
-		qk_circuit_barrier(rust_circuit_.get(), &q, 1);
+		add_barrier(&q, 1);
 	}
 
 	/// @brief Insert barrier on multiple qubits
@@ -1218,7 +1906,95 @@ public:
 		for (uint_t i = 0; i < qubits.size(); i++) {
 			qubits32[i] = (std::uint32_t)qubits[i];
 		}
-		qk_circuit_barrier(rust_circuit_.get(), qubits32.data(), (uint32_t)qubits32.size());
+		add_barrier(qubits32.data(), (uint32_t)qubits32.size());
+	}
+
+	/// @brief Insert barrier on all qubits of a register
+	/// @param qreg The register to put barrier
+	void barrier(QuantumRegister &qreg)
+	{
+		barrier(register_qubits(qreg));
+	}
+
+	// batched operations
+
+	/// @brief Append a block of standard gates at the end of the circuit
+	/// @details The block is given in struct-of-arrays form. The i-th gate takes
+	///          the next standard_gate_info(gates[i]).num_qubits entries of qubits
+	///          and the next standard_gate_info(gates[i]).num_params entries of params.
+	///          All operands are validated before the block is appended (gates,
+	///          lengths, qubit range and qubits repeated in a gate), so nothing
+	///          is added to the circuit if the block is invalid. If the C-API
+	///          still rejects a gate, false is returned with the gates before
+	///          it appended.
+	/// @param gates an array of gates
+	/// @param num_gates the number of gates in the block
+	/// @param qubits a flat array of qubits for all gates
+	/// @param num_qubit_args the length of qubits
+	/// @param params a flat array of parameters for all gates
+	/// @param num_param_args the length of params
+	/// @return true if the block is appended
+	bool append_batch(const QkGate *gates, const uint_t num_gates, const std::uint32_t *qubits, const uint_t num_qubit_args, const double *params, const uint_t num_param_args)
+	{
+		uint_t qubit_pos = 0;
+		uint_t param_pos = 0;
+		for (uint_t i = 0; i < num_gates; i++) {
+			if ((uint_t)gates[i] >= num_standard_gates) {
+				std::cerr << " QuantumCircuit::append_batch : gate " << (uint_t)gates[i] << " is not a standard gate" << std::endl;
+				return false;
+			}
+			const StandardGateInfo& info = standard_gate_info(gates[i]);
+			qubit_pos += info.num_qubits;
+			param_pos += info.num_params;
+		}
+		if (qubit_pos != num_qubit_args || param_pos != num_param_args) {
+			std::cerr << " QuantumCircuit::append_batch : block expects " << qubit_pos << " qubits and " << param_pos << " params, but "
+					  << num_qubit_args << " qubits and " << num_param_args << " params are given" << std::endl;
+			return false;
+		}
+		qubit_pos = 0;
+		for (uint_t i = 0; i < num_gates; i++) {
+			const StandardGateInfo& info = standard_gate_info(gates[i]);
+			const std::uint32_t *gate_qubits = qubits + qubit_pos;
+			for (uint_t j = 0; j < info.num_qubits; j++) {
+				if (gate_qubits[j] >= num_qubits_) {
+					std::cerr << " QuantumCircuit::append_batch : qubit " << gate_qubits[j] << " is out of range" << std::endl;
+					return false;
+				}
+				for (uint_t k = 0; k < j; k++) {
+					if (gate_qubits[k] == gate_qubits[j]) {
+						std::cerr << " QuantumCircuit::append_batch : qubit " << gate_qubits[j] << " is repeated in gate " << i << " (" << info.name << ")" << std::endl;
+						return false;
+					}
+				}
+			}
+			qubit_pos += info.num_qubits;
+		}
+
+		pre_add_gate();
+		qubit_pos = 0;
+		param_pos = 0;
+		for (uint_t i = 0; i < num_gates; i++) {
+			const StandardGateInfo& info = standard_gate_info(gates[i]);
+			QkExitCode ret = add_gate(gates[i], qubits + qubit_pos, params + param_pos);
+			if (ret != QkExitCode_Success) {
+				std::cerr << " QuantumCircuit::append_batch : failed to append gate " << i << " (" << info.name << ") : " << ret << std::endl;
+				return false;
+			}
+			qubit_pos += info.num_qubits;
+			param_pos += info.num_params;
+		}
+		return true;
+	}
+
+	/// @brief Append a block of standard gates at the end of the circuit
+	/// @param gates a list of gates
+	/// @param qubits a flat list of qubits for all gates
+	/// @param params a flat list of parameters for all gates
+	/// @return true if the block is appended
+	bool append_batch(const std::vector<QkGate> &gates, const std::vector<std::uint32_t> &qubits, const std::vector<double> &params = std::vector<double>())
+	{
+		return append_batch(gates.data(), gates.size(), qubits.data(), qubits.size(), params.data(), params.size());
 	}
 
 
@@ -1240,30 +2016,327 @@ public:
 		return qk_circuit_num_param_symbols(rust_circuit_.get());
 	}
 
-	/// @brief Assign parameters to new parameters or values.
-	/// @param keys a list of keys
+	/// @brief Return names of parameter symbols in the circuit
+	/// @details This is the order of values taken by assign_parameters.
+	///          Names are sorted, and elements of a parameter vector are
+	///          sorted by index (theta[2] comes before theta[10]).
+	/// @return a sorted list of symbol names
+	std::vector<std::string> parameter_names(void)
+	{
+		add_pending_control_flow_op();
+		return parameter_table_->names();
+	}
+
+	/// @brief Return the parameter table of the circuit
+	/// @details The table maps each symbol to the instruction slots referencing
+	///          it, and is updated when a parameterized gate is added.
+	/// @return reference to the parameter table
+	const ParameterTable &parameter_table(void) const
+	{
+		return *parameter_table_;
+	}
+
+	/// @brief Assign values to all parameters of the circuit
+	/// @details All occurrences are substituted in one pass over the
+	///          instructions. Gates whose parameters become numbers are
+	///          stored as plain standard gates.
+	/// @param values an array of values in the order of parameter_names()
+	/// @param num_values the number of values
+	/// @return true if all parameters are bound
+	bool assign_parameters(const double *values, const uint_t num_values)
+	{
+		auto names = parameter_names();
+		if (names.size() != num_values) {
+			std::cerr << " QuantumCircuit::assign_parameters : " << num_values << " values are given for " << names.size() << " parameters" << std::endl;
+			return false;
+		}
+		std::unordered_map<std::string, double> binds(num_values * 2);
+		for (uint_t i = 0; i < num_values; i++) {
+			binds[names[i]] = values[i];
+		}
+		return bind_symbols(binds);
+	}
+
+	/// @brief Assign values to all parameters of the circuit
+	/// @param values a list of values in the order of parameter_names()
+	/// @return true if all parameters are bound
+	bool assign_parameters(const std::vector<double> &values)
+	{
+		return assign_parameters(values.data(), values.size());
+	}
+
+	/// @brief Assign values to parameters by name
+	/// @details Parameters not in the map are left unbound, and names not in the circuit are ignored.
+	/// @param values a map from a parameter name to a value
+	/// @return true if all expressions with given parameters are evaluated
+	bool assign_parameters(const std::unordered_map<std::string, double> &values)
+	{
+		return bind_symbols(values);
+	}
+
+	/// @brief Assign values to parameters by name
+	/// @param keys a list of parameter names
 	/// @param values a list of values
-	void assign_parameters(const std::vector<std::string> keys, const std::vector<double> values)
+	/// @return true if all expressions with given parameters are evaluated
+	bool assign_parameters(const std::vector<std::string> &keys, const std::vector<double> &values)
 	{
-		std::vector<char *> c_keys;
+		if (keys.size() != values.size()) {
+			std::cerr << " QuantumCircuit::assign_parameters : " << values.size() << " values are given for " << keys.size() << " keys" << std::endl;
+			return false;
+		}
+		std::unordered_map<std::string, double> binds(keys.size() * 2);
 		for (uint_t i = 0; i < keys.size(); i++) {
-			c_keys.push_back((char *)keys[i].c_str());
+			binds[keys[i]] = values[i];
 		}
-		add_pending_control_flow_op();
+		return bind_symbols(binds);
+	}
+
+	/// @brief Assign a value to a parameter
+	/// @param key a parameter name
+	/// @param value a value
+	/// @return true if all expressions with the parameter are evaluated
+	bool assign_parameter(const std::string &key, const double value)
+	{
+		std::unordered_map<std::string, double> binds;
+		binds[key] = value;
+		return bind_symbols(binds);
+	}
 
-		// TO DO : add support for Parameter in Qiskit C-API
-		// qc_assign_parameters(rust_circuit_.get(), c_keys.data(), c_keys.size(), values.data(), values.size());
+	/// @brief Return a copy of the circuit with values assigned to all parameters
+	/// @param values a list of values in the order of parameter_names()
+	/// @return a bound circuit (an empty circuit if values do not match the parameters)
+	QuantumCircuit bind_parameters(const std::vector<double> &values) const
+	{
+		QuantumCircuit bound(*this);
+		if (!bound.assign_parameters(values)) {
+			return QuantumCircuit();
+		}
+		return bound;
 	}
 
-	/// @brief Assign parameter to new parameter or value.
-	/// @param key key
-	/// @param value value
-	void assign_parameter(const std::string key, const double val)
+	/// @brief Return a copy of the circuit with values assigned to parameters by name
+	/// @param values a map from a parameter name to a value
+	/// @return a bound circuit
+	QuantumCircuit bind_parameters(const std::unordered_map<std::string, double> &values) const
+	{
+		QuantumCircuit bound(*this);
+		bound.assign_parameters(values);
+		return bound;
+	}
+
+	/// @brief Bind sets of values to all parameters and return bound circuits
+	/// @details Instructions are read once and shared by all sets, and only the
+	///          parameter values are computed for each set. Registers, the
+	///          measure map and unitary matrices are shared with this circuit.
+	///          Expressions are compiled once (see CompiledExpression) and
+	///          evaluated for all sets without the C-API. Sets are bound in
+	///          parallel.
+	/// @param values an array of num_sets x num_params values, each set in the order of parameter_names()
+	/// @param num_sets the number of sets of values
+	/// @param num_params the number of values in a set
+	/// @param pool a thread pool to bind sets
+	/// @return a list of bound circuits (empty if the circuit can not be bound)
+	std::vector<QuantumCircuit> bind_sweep(const double *values, const uint_t num_sets, const uint_t num_params, ThreadPool &pool = ThreadPool::shared())
 	{
 		add_pending_control_flow_op();
+		std::vector<QuantumCircuit> circuits;
+		if (num_params != parameter_table_->size()) {
+			std::cerr << " QuantumCircuit::bind_sweep : " << num_params << " values are given for " << parameter_table_->size() << " parameters" << std::endl;
+			return circuits;
+		}
+
+		// symbol (or -1) and symbols in an expression for each symbolic slot
+		std::map<std::pair<uint_t, uint_t>, std::pair<int_t, std::vector<uint_t>>> refs;
+		std::unordered_map<std::string, uint_t> slots;
+		uint_t k = 0;
+		for (auto &entry : *parameter_table_) {
+			slots[entry.first] = k;
+			for (auto &ref : entry.second) {
+				auto &r = refs.insert(std::make_pair(std::make_pair(ref.instruction, ref.slot), std::make_pair((int_t)-1, std::vector<uint_t>()))).first->second;
+				if (ref.is_symbol) {
+					r.first = (int_t)k;
+				} else {
+					r.second.push_back(k);
+				}
+			}
+			k++;
+		}
+
+		// read instructions once
+		struct SweepOp {
+			QkOperationKind kind;
+			QkGate gate;
+			uint_t qubit_pos;
+			uint_t clbit_pos;
+			uint_t param_pos;
+			std::uint32_t num_qubits;
+			std::uint32_t num_clbits;
+			std::uint32_t num_params;
+			std::shared_ptr<const std::vector<complex_t>> matrix;
+		};
+		struct SweepParam {
+			double value;
+			int_t symbol;							// index of the symbol if the parameter is a symbol
+			int_t column;							// index of the compiled expression
+			std::shared_ptr<QkParam> expr;			// expression of symbols not compiled
+			std::vector<uint_t> symbols;			// indices of symbols in the expression
+		};
+		std::vector<SweepOp> ops;
+		std::vector<std::uint32_t> op_qubits;
+		std::vector<std::uint32_t> op_clbits;
+		std::vector<SweepParam> params;
+		std::vector<CompiledExpression> compiled;
+		bool has_expr = false;
+		uint_t unitary_pos = 0;
+		uint_t index = 0;
+		for (auto inst : instructions()) {
+			const QkCircuitInstruction &op = inst.instruction();
+			SweepOp sop = {inst.kind(), QkGate_GlobalPhase, op_qubits.size(), op_clbits.size(), params.size(), op.num_qubits, op.num_clbits, op.num_params, nullptr};
+			switch (sop.kind) {
+			case QkOperationKind_Gate:
+				if (inst.gate_info() == nullptr) {
+					std::cerr << " QuantumCircuit::bind_sweep : non-standard gate " << op.name << " is not supported" << std::endl;
+					return circuits;
+				}
+				sop.gate = inst.gate_info()->gate;
+				for (uint_t j = 0; j < op.num_params; j++) {
+					SweepParam p = {0.0, -1, -1, nullptr, std::vector<uint_t>()};
+					auto r = refs.find(std::make_pair(index, j));
+					if (r == refs.end()) {
+						p.value = qk_param_as_real(op.params[j]);
+					} else if (r->second.first >= 0) {
+						p.symbol = r->second.first;
+					} else {
+						char *str = qk_param_str(op.params[j]);
+						CompiledExpression expr;
+						if (expr.compile(str, slots, num_params)) {
+							p.column = compiled.size();
+							compiled.push_back(std::move(expr));
+						} else {
+							p.expr = std::shared_ptr<QkParam>(qk_param_copy(op.params[j]), qk_param_free);
+							p.symbols = r->second.second;
+							has_expr = true;
+						}
+						qk_str_free(str);
+					}
+					params.push_back(p);
+				}
+				break;
+			case QkOperationKind_Unitary:
+				while (unitary_pos < unitary_ops_->size() && (*unitary_ops_)[unitary_pos].first < index) {
+					unitary_pos++;
+				}
+				if (unitary_pos == unitary_ops_->size() || (*unitary_ops_)[unitary_pos].first != index) {
+					std::cerr << " QuantumCircuit::bind_sweep : matrix of unitary at " << index << " is not available" << std::endl;
+					return circuits;
+				}
+				sop.matrix = (*unitary_ops_)[unitary_pos].second;
+				break;
+			case QkOperationKind_Measure:
+			case QkOperationKind_Reset:
+			case QkOperationKind_Barrier:
+				break;
+			default:
+				std::cerr << " QuantumCircuit::bind_sweep : operation " << op.name << " is not supported" << std::endl;
+				return circuits;
+			}
+			op_qubits.insert(op_qubits.end(), op.qubits, op.qubits + op.num_qubits);
+			op_clbits.insert(op_clbits.end(), op.clbits, op.clbits + op.num_clbits);
+			ops.push_back(sop);
+			index++;
+		}
+
+		std::vector<std::shared_ptr<QkParam>> symbols;
+		if (has_expr) {
+#ifdef QISKIT_CAPI_HAS_SUBS
+			auto names = parameter_table_->names();
+			for (auto &name : names) {
+				symbols.push_back(std::shared_ptr<QkParam>(qk_param_new_symbol(name.c_str()), qk_param_free));
+			}
+#else
+			std::cerr << " QuantumCircuit::bind_sweep : expressions can not be bound without qk_param_bind" << std::endl;
+			return circuits;
+#endif
+		}
 
-		// TO DO : add support for Parameter in Qiskit C-API
-		// qc_assign_parameter(rust_circuit_.get(), (char*)key.c_str(), val);
+		// evaluate compiled expressions for all sets
+		std::vector<double> expr_values(compiled.size() * num_sets);
+		pool.parallel_for(compiled.size(), [&](uint_t e) {
+			compiled[e].evaluate(values, num_sets, num_params, expr_values.data() + e * num_sets);
+		});
+
+		circuits.resize(num_sets);
+		std::atomic<bool> failed(false);
+		pool.parallel_for(num_sets, [&](uint_t set) {
+			const double *set_values = values + set * num_params;
+			QuantumCircuit bound(*this);
+			bound.rust_circuit_ = empty_rust_circuit();
+			bound.unitary_ops_ = std::make_shared<std::vector<std::pair<uint_t, std::shared_ptr<const std::vector<complex_t>>>>>();
+			bound.metrics_ = std::make_shared<CircuitMetrics>();
+			bound.parameter_table_ = std::make_shared<ParameterTable>();
+			bound.ops_fingerprint_ = Fingerprint();
+			bound.hashable_ = true;
+
+			double dparams[4];
+			std::vector<const QkParam *> keys;
+			std::vector<double> key_values;
+			for (auto &sop : ops) {
+				const std::uint32_t *qubits = op_qubits.data() + sop.qubit_pos;
+				switch (sop.kind) {
+				case QkOperationKind_Gate:
+					for (uint_t j = 0; j < sop.num_params; j++) {
+						const SweepParam &p = params[sop.param_pos + j];
+						if (p.symbol >= 0) {
+							dparams[j] = set_values[p.symbol];
+						} else if (p.column >= 0) {
+							dparams[j] = expr_values[p.column * num_sets + set];
+							if (std::isnan(dparams[j])) {
+								failed = true;
+							}
+						} else if (p.expr) {
+#ifdef QISKIT_CAPI_HAS_SUBS
+							keys.clear();
+							key_values.clear();
+							for (auto s : p.symbols) {
+								keys.push_back(symbols[s].get());
+								key_values.push_back(set_values[s]);
+							}
+							std::shared_ptr<QkParam> out(qk_param_zero(), qk_param_free);
+							qk_param_bind(out.get(), p.expr.get(), keys.data(), key_values.data(), keys.size());
+							dparams[j] = qk_param_as_real(out.get());
+#endif
+							if (std::isnan(dparams[j])) {
+								failed = true;
+							}
+						} else {
+							dparams[j] = p.value;
+						}
+					}
+					bound.add_gate(sop.gate, qubits, dparams);
+					break;
+				case QkOperationKind_Measure:
+					bound.add_measure(qubits[0], op_clbits[sop.clbit_pos]);
+					break;
+				case QkOperationKind_Reset:
+					bound.add_reset(qubits[0]);
+					break;
+				case QkOperationKind_Barrier:
+					bound.add_barrier(qubits, sop.num_qubits);
+					break;
+				case QkOperationKind_Unitary:
+					bound.add_unitary(sop.matrix, qubits, sop.num_qubits, false);
+					break;
+				default:
+					break;
+				}
+			}
+			circuits[set] = std::move(bound);
+		});
+		if (failed) {
+			std::cerr << " QuantumCircuit::bind_sweep : an expression is not evaluated to a real number" << std::endl;
+			circuits.clear();
+		}
+		return circuits;
 	}
 
 	QuantumCircuit &operator+=(QuantumCircuit &rhs)
@@ -1310,58 +2383,107 @@ public:
 	}
 
 	/// @brief Add other circuit at the end of this circuit
+	/// @details Operands are remapped through tables built once per call.
+	///          If both mappings are the identity, operands of the source
+	///          instructions are passed through without remapping.
 	/// @param circ circuit to be added
 	/// @param qubits a list of qubits to be mapped
 	/// @param clits a list of clbits to be mapped
 	void compose(QuantumCircuit &circ, const reg_t &qubits, const reg_t &clbits)
 	{
 		pre_add_gate();
-		uint_t size = std::min(qubits.size(), clbits.size());
-		std::vector<std::uint32_t> vqubits(size);
-		for (uint_t i = 0; i < size; i++) {
-			vqubits[i] = (std::uint32_t)qubits[i];
-		}
-		std::vector<std::uint32_t> vclbits(size);
-		for (uint_t i = 0; i < size; i++) {
-			vclbits[i] = (std::uint32_t)clbits[i];
+		circ.add_pending_control_flow_op();
+
+		if (qubits.size() < circ.num_qubits_ || clbits.size() < circ.num_clbits_) {
+			std::cerr << " QuantumCircuit::compose : " << circ.num_qubits_ << " qubits and " << circ.num_clbits_ << " clbits should be mapped, but "
+					  << qubits.size() << " qubits and " << clbits.size() << " clbits are given" << std::endl;
+			return;
 		}
 
-		uint_t nops;
-		nops = qk_circuit_num_instructions(circ.rust_circuit_.get());
+		// remap tables
+		bool identity = true;
+		std::vector<std::uint32_t> qubit_map(circ.num_qubits_);
+		for (uint_t i = 0; i < circ.num_qubits_; i++) {
+			if (qubits[i] >= num_qubits_) {
+				std::cerr << " QuantumCircuit::compose : qubit " << qubits[i] << " is out of range" << std::endl;
+				return;
+			}
+			qubit_map[i] = (std::uint32_t)qubits[i];
+			identity &= (qubits[i] == i);
+		}
+		std::vector<std::uint32_t> clbit_map(circ.num_clbits_);
+		for (uint_t i = 0; i < circ.num_clbits_; i++) {
+			if (clbits[i] >= num_clbits_) {
+				std::cerr << " QuantumCircuit::compose : clbit " << clbits[i] << " is out of range" << std::endl;
+				return;
+			}
+			clbit_map[i] = (std::uint32_t)clbits[i];
+			identity &= (clbits[i] == i);
+		}
 
-		auto name_map = get_standard_gate_name_mapping();
-		for (uint_t i = 0; i < nops; i++) {
-			QkCircuitInstruction *op = new QkCircuitInstruction;
-			qk_circuit_get_instruction(circ.rust_circuit_.get(), i, op);
+		// compose may be called with this circuit itself, so keep the source table
+		auto src_unitaries = circ.unitary_ops_;
+		unshare(unitary_ops_);
+		uint_t unitary_pos = 0;
+
+		std::vector<std::uint32_t> op_qubits;
+		std::vector<std::uint32_t> op_clbits;
+		for (auto inst : circ.instructions()) {
+			QkOperationKind kind = inst.kind();
+			const QkCircuitInstruction &op = inst.instruction();
+			const std::uint32_t *mapped_qubits = op.qubits;
+			const std::uint32_t *mapped_clbits = op.clbits;
+			if (!identity) {
+				op_qubits.resize(op.num_qubits);
+				for (uint_t j = 0; j < op.num_qubits; j++) {
+					op_qubits[j] = qubit_map[op.qubits[j]];
+				}
+				op_clbits.resize(op.num_clbits);
+				for (uint_t j = 0; j < op.num_clbits; j++) {
+					op_clbits[j] = clbit_map[op.clbits[j]];
+				}
+				mapped_qubits = op_qubits.data();
+				mapped_clbits = op_clbits.data();
+			}
 
-			std::vector<std::uint32_t> vqubits(op->num_qubits);
-			std::vector<std::uint32_t> vclbits;
-			for (uint_t j = 0; j < op->num_qubits; j++) {
-				vqubits[j] = (std::uint32_t)qubits[op->qubits[j]];
+			switch (kind) {
+			case QkOperationKind_Gate:
+			{
+				const StandardGateInfo *gate = inst.gate_info();
+				if (gate != nullptr) {
+					add_parameterized_gate(gate->gate, mapped_qubits, op.params);
+				} else {
+					std::cerr << " QuantumCircuit::compose : non-standard gate " << op.name << " is skipped" << std::endl;
+				}
+				break;
 			}
-			if (op->num_clbits > 0) {
-				vclbits.resize(op->num_clbits);
-				for (uint_t j = 0; j < op->num_clbits; j++) {
-					vclbits[j] = (std::uint32_t)clbits[op->clbits[j]];
+			case QkOperationKind_Measure:
+				add_measure(mapped_qubits[0], mapped_clbits[0]);
+				measure_map_->push_back(std::pair<uint_t, uint_t>(mapped_qubits[0], mapped_clbits[0]));
+				break;
+			case QkOperationKind_Reset:
+				add_reset(mapped_qubits[0]);
+				break;
+			case QkOperationKind_Barrier:
+				add_barrier(mapped_qubits, op.num_qubits);
+				break;
+			case QkOperationKind_Unitary:
+			{
+				while (unitary_pos < src_unitaries->size() && (*src_unitaries)[unitary_pos].first < inst.index()) {
+					unitary_pos++;
 				}
+				if (unitary_pos < src_unitaries->size() && (*src_unitaries)[unitary_pos].first == inst.index()) {
+					// the matrix was checked when it was added to the source circuit
+					add_unitary((*src_unitaries)[unitary_pos].second, mapped_qubits, op.num_qubits, false);
+				} else {
+					std::cerr << " QuantumCircuit::compose : matrix of unitary at " << inst.index() << " is not available" << std::endl;
+				}
+				break;
 			}
-			QkOperationKind kind = qk_circuit_instruction_kind(rust_circuit_.get(), i);
-			if (kind == QkOperationKind_Measure) {
-				qk_circuit_measure(rust_circuit_.get(), vqubits[0], vclbits[0]);
-			} else if (kind == QkOperationKind_Reset) {
-				qk_circuit_reset(rust_circuit_.get(), vqubits[0]);
-			} else if (kind == QkOperationKind_Barrier) {
-				qk_circuit_barrier(rust_circuit_.get(), vqubits.data(), (uint32_t)vqubits.size());
-			} else if (kind == QkOperationKind_Gate) {
-				qk_circuit_parameterized_gate(rust_circuit_.get(), name_map[op->name].gate_map(), vqubits.data(), op->params);
-			} else if (kind == QkOperationKind_Unitary) {
-				// TO DO : how we can get unitary matrix from Rust ?
+			default:
+				std::cerr << " QuantumCircuit::compose : operation " << op.name << " is not supported" << std::endl;
+				break;
 			}
-			qk_circuit_instruction_clear(op);
-		}
-
-		for (auto m : circ.measure_map_) {
-			measure_map_.push_back(m);
 		}
 	}
 
@@ -1379,24 +2501,24 @@ public:
 			pre_add_gate();
 			if (op.is_standard_gate()) {
 				if (op.num_params() > 0) {
-					std::vector<QkParam*> params;
+					std::vector<const Parameter*> params;
 					for (auto &p : op.params()) {
-						params.push_back(p.qiskit_param_.get());
+						params.push_back(&p);
 					}
-					qk_circuit_parameterized_gate(rust_circuit_.get(), op.gate_map(), vqubits.data(), params.data());
+					add_parameterized_gate(op.gate_map(), vqubits.data(), params.data());
 				}
 				else
-					qk_circuit_gate(rust_circuit_.get(), op.gate_map(), vqubits.data(), nullptr);
+					add_gate(op.gate_map(), vqubits.data(), nullptr);
 			} else {
 				if (std::string("reset") == op.name()) {
-					qk_circuit_reset(rust_circuit_.get(), vqubits[0]);
+					add_reset(vqubits[0]);
 				}
 				else if (std::string("barrier") == op.name()) {
-					qk_circuit_barrier(rust_circuit_.get(), vqubits.data(), (uint32_t)vqubits.size());
+					add_barrier(vqubits.data(), (uint32_t)vqubits.size());
 				}
 				else if (std::string("measure") == op.name()) {
-					qk_circuit_measure(rust_circuit_.get(), vqubits[0], vqubits[0]);
-					measure_map_.push_back(std::pair<uint_t, uint_t>(qubits[0], qubits[0]));
+					add_measure(vqubits[0], vqubits[0]);
+					measure_map_->push_back(std::pair<uint_t, uint_t>(qubits[0], qubits[0]));
 				}
 			}
 		}
@@ -1408,73 +2530,308 @@ public:
 			pre_add_gate();
 			if (op.is_standard_gate()) {
 				if (op.num_params() > 0) {
-					std::vector<QkParam*> params;
+					std::vector<const Parameter*> params;
 					for (auto &p : op.params()) {
-						params.push_back(p.qiskit_param_.get());
+						params.push_back(&p);
 					}
-					qk_circuit_parameterized_gate(rust_circuit_.get(), op.gate_map(), qubits.data(), params.data());
+					add_parameterized_gate(op.gate_map(), qubits.data(), params.data());
 				}
 				else
-					qk_circuit_gate(rust_circuit_.get(), op.gate_map(), qubits.data(), nullptr);
+					add_gate(op.gate_map(), qubits.data(), nullptr);
 			} else {
 				if (std::string("reset") == op.name()) {
-					qk_circuit_reset(rust_circuit_.get(), qubits[0]);
+					add_reset(qubits[0]);
 				}
 				else if (std::string("barrier") == op.name()) {
-					qk_circuit_barrier(rust_circuit_.get(), qubits.data(), (uint32_t)qubits.size());
+					add_barrier(qubits.data(), (uint32_t)qubits.size());
 				}
 				else if (std::string("measure") == op.name()) {
-					qk_circuit_measure(rust_circuit_.get(), qubits[0], qubits[0]);
-					measure_map_.push_back(std::pair<uint_t, uint_t>((uint_t)qubits[0], (uint_t)qubits[0]));
+					add_measure(qubits[0], qubits[0]);
+					measure_map_->push_back(std::pair<uint_t, uint_t>((uint_t)qubits[0], (uint_t)qubits[0]));
+				}
+			}
+		}
+	}
+
+	/// @brief append a gate at the end of the circuit
+	/// @param inst an instruction to be added
+	void append(const CircuitInstruction &inst)
+	{
+		std::vector<std::uint32_t> vqubits(inst.qubits().size());
+		for (uint_t i = 0; i < inst.qubits().size(); i++) {
+			vqubits[i] = (std::uint32_t)inst.qubits()[i];
+		}
+		pre_add_gate();
+		if (inst.instruction().is_standard_gate()) {
+			if (inst.instruction().num_params() > 0) {
+				std::vector<const Parameter*> params;
+				for (auto &p : inst.instruction().params()) {
+					params.push_back(&p);
+				}
+				add_parameterized_gate(inst.instruction().gate_map(), vqubits.data(), params.data());
+			}
+			else
+				add_gate(inst.instruction().gate_map(), vqubits.data(), nullptr);
+		} else {
+			if (std::string("reset") == inst.instruction().name()) {
+				add_reset(vqubits[0]);
+			}
+			else if (std::string("barrier") == inst.instruction().name()) {
+				add_barrier(vqubits.data(), (uint32_t)vqubits.size());
+			}
+			else if (std::string("measure") == inst.instruction().name()) {
+				add_measure(vqubits[0], (std::uint32_t)inst.clbits()[0]);
+				measure_map_->push_back(std::pair<uint_t, uint_t>(inst.qubits()[0], inst.clbits()[0]));
+			}
+		}
+	}
+
+	void append(const Instruction &op, const uint_t qubit)
+	{
+		reg_t qubits({qubit});
+		append(op, qubits);
+	}
+
+	/// @brief Remove operations that can not affect measured clbits
+	/// @details The circuit is walked backwards from the end, tracking qubits
+	///          in the causal past of measurements whose results are not
+	///          overwritten. Gates outside of it, measurements overwritten by
+	///          later measurements and operations before a reset of an
+	///          unmeasured qubit are removed. Operations without operands
+	///          (e.g. global phase) are kept. A circuit without measurements
+	///          has no light cone, and is not modified. The circuit is not
+	///          modified either if an operation to be kept can not be added
+	///          again through this class (e.g. delays, control flow,
+	///          non-standard gates or unitaries without matrices).
+	/// @return the number of removed instructions
+	uint_t reduce_to_lightcone(void)
+	{
+		add_pending_control_flow_op();
+		if (measure_map_->empty()) {
+			return 0;
+		}
+
+		uint_t nops = qk_circuit_num_instructions(rust_circuit_.get());
+		std::vector<bool> keep(nops, true);
+		std::vector<bool> active(num_qubits_, false);	// qubits whose state can affect measured clbits
+		std::vector<bool> live(num_clbits_, true);		// clbits whose value is not overwritten later
+		uint_t num_removed = 0;
+		for (uint_t i = nops; i-- > 0;) {
+			InstructionIterator it(rust_circuit_.get(), i);
+			QkOperationKind kind = it.kind();
+			const QkCircuitInstruction &op = it.instruction();
+			bool any_active = false;
+			for (uint_t j = 0; j < op.num_qubits; j++) {
+				any_active |= active[op.qubits[j]];
+			}
+
+			switch (kind) {
+			case QkOperationKind_Measure:
+				keep[i] = live[op.clbits[0]] || any_active;
+				if (live[op.clbits[0]]) {
+					live[op.clbits[0]] = false;
+					active[op.qubits[0]] = true;
+				}
+				break;
+			case QkOperationKind_Reset:
+				keep[i] = any_active;
+				active[op.qubits[0]] = false;
+				break;
+			case QkOperationKind_Barrier:
+				keep[i] = any_active;
+				break;
+			case QkOperationKind_Unitary:
+				if (any_active && !has_unitary_matrix(i)) {
+					std::cerr << " QuantumCircuit::reduce_to_lightcone : matrix of unitary at " << i << " is not available" << std::endl;
+					return 0;
+				}
+				keep[i] = any_active;
+				for (uint_t j = 0; j < op.num_qubits; j++) {
+					active[op.qubits[j]] = any_active;
+				}
+				break;
+			case QkOperationKind_Gate:
+				keep[i] = any_active || op.num_qubits == 0;
+				if (keep[i] && (*it).gate_info() == nullptr) {
+					std::cerr << " QuantumCircuit::reduce_to_lightcone : non-standard gate " << op.name << " at " << i << " can not be rebuilt" << std::endl;
+					return 0;
+				}
+				for (uint_t j = 0; j < op.num_qubits; j++) {
+					active[op.qubits[j]] = any_active;
+				}
+				break;
+			default:
+				// delays, control flow and other operations can not be added through this class
+				std::cerr << " QuantumCircuit::reduce_to_lightcone : operation " << op.name << " at " << i << " can not be rebuilt" << std::endl;
+				return 0;
+			}
+			if (!keep[i]) {
+				num_removed++;
+			}
+		}
+		if (num_removed == 0) {
+			return 0;
+		}
+
+		// rebuild the circuit with remaining instructions
+		auto src = rust_circuit_;
+		auto src_unitaries = unitary_ops_;
+		rust_circuit_ = empty_rust_circuit();
+		unitary_ops_ = std::make_shared<std::vector<std::pair<uint_t, std::shared_ptr<const std::vector<complex_t>>>>>();
+		measure_map_ = std::make_shared<std::vector<std::pair<uint_t, uint_t>>>();
+		metrics_ = std::make_shared<CircuitMetrics>();
+		parameter_table_ = std::make_shared<ParameterTable>();
+		ops_fingerprint_ = Fingerprint();
+		hashable_ = true;
+
+		uint_t unitary_pos = 0;
+		InstructionIterator it(src.get(), 0);
+		for (uint_t i = 0; i < nops; i++, ++it) {
+			if (!keep[i]) {
+				continue;
+			}
+			InstructionView inst = *it;
+			const QkCircuitInstruction &op = inst.instruction();
+			switch (inst.kind()) {
+			case QkOperationKind_Gate:
+			{
+				add_parameterized_gate(inst.gate_info()->gate, op.qubits, op.params);
+				break;
+			}
+			case QkOperationKind_Measure:
+				add_measure(op.qubits[0], op.clbits[0]);
+				measure_map_->push_back(std::pair<uint_t, uint_t>(op.qubits[0], op.clbits[0]));
+				break;
+			case QkOperationKind_Reset:
+				add_reset(op.qubits[0]);
+				break;
+			case QkOperationKind_Barrier:
+				add_barrier(op.qubits, op.num_qubits);
+				break;
+			case QkOperationKind_Unitary:
+			{
+				while (unitary_pos < src_unitaries->size() && (*src_unitaries)[unitary_pos].first < i) {
+					unitary_pos++;
 				}
+				add_unitary((*src_unitaries)[unitary_pos].second, op.qubits, op.num_qubits, false);
+				break;
+			}
+			default:
+				break;
 			}
 		}
+		return num_removed;
 	}
 
-	/// @brief append a gate at the end of the circuit
-	/// @param inst an instruction to be added
-	void append(const CircuitInstruction &inst)
+	/// @brief get number og instructions
+	/// @return number of instructions in the circuit
+	uint_t num_instructions(void)
 	{
-		std::vector<std::uint32_t> vqubits(inst.qubits().size());
-		for (uint_t i = 0; i < inst.qubits().size(); i++) {
-			vqubits[i] = (std::uint32_t)inst.qubits()[i];
+		return qk_circuit_num_instructions(rust_circuit_.get());
+	}
+
+	/// @brief get a range of instructions to be used in range-based for
+	/// @details Instructions are read through a single reused buffer without
+	///          heap allocation, e.g. for (auto inst : circ.instructions()) {...}
+	/// @return a range of instructions in the circuit
+	InstructionRange instructions(void) const
+	{
+		return InstructionRange(rust_circuit_.get());
+	}
+
+	/// @brief Return a structural hash of the circuit
+	/// @details The hash covers the instruction stream (kinds, names, qubits,
+	///          clbits, parameter values and symbols), the registers and the
+	///          global phase. Registers are hashed by their sizes, because
+	///          auto-generated register names are unique to each circuit.
+	///          The hash of instructions is updated when an instruction is
+	///          added, so this takes O(number of registers).
+	///          Matrices of unitaries are hashed if they are added through
+	///          this class, but not if the circuit is set by a transpiler
+	///          (see is_hashable).
+	/// @return 128-bit fingerprint
+	Fingerprint fingerprint(void) const
+	{
+		Fingerprint fp = ops_fingerprint_;
+		fp.add(num_qubits_);
+		fp.add(num_clbits_);
+		fp.add(qregs_->size());
+		for (auto &qreg : *qregs_) {
+			fp.add(qreg.size());
 		}
-		pre_add_gate();
-		if (inst.instruction().is_standard_gate()) {
-			if (inst.instruction().num_params() > 0) {
-				std::vector<QkParam*> params;
-				for (auto &p : inst.instruction().params()) {
-					params.push_back(p.qiskit_param_.get());
-				}
-				qk_circuit_parameterized_gate(rust_circuit_.get(), inst.instruction().gate_map(), vqubits.data(), params.data());
-			}
-			else
-				qk_circuit_gate(rust_circuit_.get(), inst.instruction().gate_map(), vqubits.data(), nullptr);
-		} else {
-			if (std::string("reset") == inst.instruction().name()) {
-				qk_circuit_reset(rust_circuit_.get(), vqubits[0]);
-			}
-			else if (std::string("barrier") == inst.instruction().name()) {
-				qk_circuit_barrier(rust_circuit_.get(), vqubits.data(), (uint32_t)vqubits.size());
-			}
-			else if (std::string("measure") == inst.instruction().name()) {
-				qk_circuit_measure(rust_circuit_.get(), vqubits[0], (std::uint32_t)inst.clbits()[0]);
-				measure_map_.push_back(std::pair<uint_t, uint_t>(inst.qubits()[0], inst.clbits()[0]));
-			}
+		fp.add(cregs_->size());
+		for (auto &creg : *cregs_) {
+			fp.add(creg.size());
 		}
+		fp.add_double(global_phase_);
+		return fp;
 	}
 
-	void append(const Instruction &op, const uint_t qubit)
+	/// @brief Return if the content of the circuit can be hashed
+	/// @return false if the circuit has unitaries set by a transpiler, whose matrices are not in fingerprint()
+	bool is_hashable(void) const
 	{
-		reg_t qubits({qubit});
-		append(op, qubits);
+		return hashable_;
 	}
 
-	/// @brief get number og instructions
-	/// @return number of instructions in the circuit
-	uint_t num_instructions(void)
+	/// @brief Return metrics of the circuit
+	/// @details Metrics are updated when an instruction is added, so they are
+	///          available without scanning the circuit.
+	/// @return reference to the metrics
+	const CircuitMetrics &metrics(void) const
 	{
-		return qk_circuit_num_instructions(rust_circuit_.get());
+		return *metrics_;
+	}
+
+	/// @brief Return depth of the circuit
+	/// @return the length of the critical path
+	uint_t depth(void) const
+	{
+		return metrics_->depth();
+	}
+
+	/// @brief Return depth of the circuit counting only multi-qubit operations
+	/// @return the number of multi-qubit operations on the critical path
+	uint_t depth_2q(void) const
+	{
+		return metrics_->depth_2q();
+	}
+
+	/// @brief Return counts of operations
+	/// @return a map from operation name to count
+	std::map<std::string, uint_t> count_ops(void) const
+	{
+		return metrics_->count_ops();
+	}
+
+	/// @brief Return number of operations acting on more than one qubit
+	/// @return the number of non-local operations
+	uint_t num_nonlocal_gates(void) const
+	{
+		return metrics_->num_nonlocal_gates();
+	}
+
+	/// @brief Return layers of the circuit
+	/// @details Every instruction is placed in the layer following the last
+	///          instruction on its qubits and clbits, in one pass over the
+	///          circuit. Barriers and operations without operands are not
+	///          placed in any layer.
+	/// @return a list of layers, each of which is a list of instruction indices
+	std::vector<reg_t> layers(void) const
+	{
+		std::vector<reg_t> ret;
+		CircuitMetrics metrics;
+		for (auto inst : instructions()) {
+			const QkCircuitInstruction &op = inst.instruction();
+			uint_t level = metrics.add(inst.kind(), op.name, inst.gate_info(), op.qubits, op.num_qubits, op.clbits, op.num_clbits);
+			if (level > 0) {
+				if (level > ret.size()) {
+					ret.resize(level);
+				}
+				ret[level - 1].push_back(inst.index());
+			}
+		}
+		return ret;
 	}
 
 	/// @brief get instruction
@@ -1483,33 +2840,20 @@ public:
 	CircuitInstruction operator[](uint_t i)
 	{
 		if (i < qk_circuit_num_instructions(rust_circuit_.get())) {
-			auto name_map = get_standard_gate_name_mapping();
-
-			QkOperationKind kind = qk_circuit_instruction_kind(rust_circuit_.get(), i);
-			QkCircuitInstruction *op = new QkCircuitInstruction;
-			qk_circuit_get_instruction(rust_circuit_.get(), i, op);
-			reg_t qubits;
-			if (op->num_qubits > 0) {
-				qubits.resize(op->num_qubits);
-				for (int i = 0; i < op->num_qubits; i++)
-					qubits[i] = op->qubits[i];
-			}
-
-			reg_t clbits;
-			if (op->num_clbits > 0) {
-				clbits.resize(op->num_clbits);
-				for (int i = 0; i < op->num_clbits; i++)
-					clbits[i] = op->clbits[i];
-			}
+			InstructionIterator it(rust_circuit_.get(), i);
+			auto op = *it;
+			QkOperationKind kind = op.kind();
+			auto op_qubits = op.qubits();
+			reg_t qubits(op_qubits.begin(), op_qubits.end());
+			auto op_clbits = op.clbits();
+			reg_t clbits(op_clbits.begin(), op_clbits.end());
 
 			std::vector<Parameter> params;
-			if (op->num_params > 0) {
-				params.resize(op->num_params);
-				for (int i = 0; i < op->num_params; i++)
-					params[i] = Parameter(qk_param_copy(op->params[i]));
+			params.reserve(op.params().size());
+			for (auto p : op.params()) {
+				params.push_back(Parameter(qk_param_copy(p)));
 			}
-			std::string name = op->name;
-			qk_circuit_instruction_clear(op);
+			const StandardGateInfo* gate = op.gate_info();
 
 			if (kind == QkOperationKind_Measure) {
 				auto inst = Measure();
@@ -1523,9 +2867,8 @@ public:
 			}
 
 			// standard gates
-			auto gate = name_map.find(name);
-			if (gate != name_map.end()) {
-				auto inst = gate->second;
+			if (gate != nullptr) {
+				auto inst = standard_gate_instruction(*gate);
 				if (params.size() > 0) {
 					inst.set_params(params);
 				}
@@ -1537,7 +2880,72 @@ public:
 
 	// qasm3
 
+	/// @brief Return the OpenQASM3 identifier of a parameter
+	/// @details ASCII characters not allowed in identifiers (e.g. brackets
+	///          of vector elements) are replaced by '_', and bytes of
+	///          non-ASCII characters are replaced by their hex codes (e.g.
+	///          U+03B8 in UTF-8 is "_xce_xb8"). Different names can have the same
+	///          identifier (e.g. "a[1]" and "a_1_"), see qasm3_identifiers().
+	/// @param name name of the parameter
+	/// @return an identifier
+	static std::string qasm3_identifier(const std::string& name)
+	{
+		static const char hex[] = "0123456789abcdef";
+		std::string ret;
+		ret.reserve(name.size());
+		for (auto c : name) {
+			unsigned char u = static_cast<unsigned char>(c);
+			if (std::isalnum(u) || c == '_') {
+				ret += c;
+			} else if (u < 0x80) {
+				ret += '_';
+			} else {
+				ret += "_x";
+				ret += hex[u >> 4];
+				ret += hex[u & 15];
+			}
+		}
+		if (ret.empty() || std::isdigit(static_cast<unsigned char>(ret[0]))) {
+			ret.insert(0, "_");
+		}
+		return ret;
+	}
+
+	/// @brief Return unique OpenQASM3 identifiers of parameters
+	/// @details Names which are identifiers are kept. Other names are
+	///          converted by qasm3_identifier(), and a suffix "_<n>" is added
+	///          if the identifier is already used, so all identifiers are
+	///          unique.
+	/// @param names names of parameters in the order of parameter_names()
+	/// @return the names declared as inputs in to_qasm3()
+	static std::vector<std::string> qasm3_identifiers(const std::vector<std::string>& names)
+	{
+		std::vector<std::string> ids(names.size());
+		std::unordered_set<std::string> used(names.size() * 2);
+		for (uint_t i = 0; i < names.size(); i++) {
+			if (qasm3_identifier(names[i]) == names[i]) {
+				ids[i] = names[i];
+				used.insert(names[i]);
+			}
+		}
+		for (uint_t i = 0; i < names.size(); i++) {
+			if (!ids[i].empty()) {
+				continue;
+			}
+			std::string id = qasm3_identifier(names[i]);
+			std::string unique = id;
+			for (uint_t n = 1; used.count(unique) > 0; n++) {
+				unique = id + "_" + std::to_string(n);
+			}
+			ids[i] = unique;
+			used.insert(unique);
+		}
+		return ids;
+	}
+
 	/// @brief Serialize a QuantumCircuit object as an OpenQASM3 string.
+	/// @details Parameters are declared as `input float[64]`, so values can
+	///          be bound when the circuit is run (see SamplerPub).
 	/// @return An OpenQASM3 string.
 	std::string to_qasm3(void)
 	{
@@ -1548,14 +2956,14 @@ public:
 		qasm3 << "OPENQASM 3.0;" << std::endl;
 		qasm3 << "include \"stdgates.inc\";" << std::endl;
 
-		auto name_map = get_standard_gate_name_mapping();
 		// add header for non-standard gates
 		bool cs = false;
 		bool sxdg = false;
 		QkOpCounts opcounts = qk_circuit_count_ops(rust_circuit_.get());
 		for (int i = 0; i < opcounts.len; i++) {
-			if (opcounts.data[i].count != 0) {
-				auto op = name_map[opcounts.data[i].name].gate_map();
+			const StandardGateInfo* gate = find_standard_gate(opcounts.data[i].name);
+			if (opcounts.data[i].count != 0 && gate != nullptr) {
+				auto op = gate->gate;
 				switch (op)
 				{
 				case QkGate_R:
@@ -1834,66 +3242,85 @@ public:
 		}
 		qk_opcounts_clear(&opcounts);
 
-		// save ops
-		uint_t nops;
-		nops = qk_circuit_num_instructions(rust_circuit_.get());
+		// declare parameters as inputs
+		std::unordered_map<std::string, std::string> renamed;
+		std::vector<std::string> names = parameter_table_->names();
+		std::vector<std::string> ids = qasm3_identifiers(names);
+		for (uint_t i = 0; i < names.size(); i++) {
+			qasm3 << "input float[64] " << ids[i] << ";" << std::endl;
+			if (ids[i] != names[i]) {
+				renamed[names[i]] = ids[i];
+			}
+		}
+
 
 		// Declare registers
 		// After transpilation, qubit registers will be mapped to physical registers,
 		// so we need to combined them in a single quantum register "q";
 		const std::string qreg_name = "q";
 		qasm3 << "qubit[" << num_qubits() << "] " << qreg_name << ";" << std::endl;
-		for(const auto& creg : cregs_) {
+		for(const auto& creg : *cregs_) {
 			qasm3 << "bit[" << creg.size() << "] " << creg.name() << ";" << std::endl;
 		}
 
 		auto recover_reg_data = [this](uint_t index) -> std::pair<std::string, uint_t>
 		{
-			auto it = std::upper_bound(cregs_.begin(), cregs_.end(), index,
+			auto it = std::upper_bound(cregs_->begin(), cregs_->end(), index,
 					[](uint_t v, const ClassicalRegister& reg) { return v < reg.base_index(); });
-			assert(it != cregs_.begin());
+			assert(it != cregs_->begin());
 			it = std::prev(it);
 			return std::make_pair(it->name(), index - it->base_index());
 		};
 
-		for (uint_t i = 0; i < nops; i++) {
-			QkCircuitInstruction *op = new QkCircuitInstruction;
-			qk_circuit_get_instruction(rust_circuit_.get(), i, op);
-			if (op->num_clbits > 0) {
-				if (op->num_qubits == op->num_clbits) {
-					for (uint_t j = 0; j < op->num_qubits; j++) {
-						const auto creg_data = recover_reg_data(op->clbits[j]);
-						qasm3 << creg_data.first << "[" << creg_data.second << "] = " << op->name << " " << qreg_name << "[" << op->qubits[j] << "];" << std::endl;
+		for (auto inst : instructions()) {
+			const QkCircuitInstruction& op = inst.instruction();
+			if (op.num_clbits > 0) {
+				if (op.num_qubits == op.num_clbits) {
+					for (uint_t j = 0; j < op.num_qubits; j++) {
+						const auto creg_data = recover_reg_data(op.clbits[j]);
+						qasm3 << creg_data.first << "[" << creg_data.second << "] = " << op.name << " " << qreg_name << "[" << op.qubits[j] << "];" << std::endl;
 					}
 				}
 			} else {
-				if (strcmp(op->name, "u") == 0) {
-					qasm3 << "U";
+				const StandardGateInfo* gate = inst.gate_info();
+				if (gate != nullptr) {
+					qasm3 << gate->qasm_name;
 				} else {
-					qasm3 << op->name;
+					qasm3 << op.name;
 				}
-				if (op->num_params > 0) {
+				if (op.num_params > 0) {
 					qasm3 << "(";
-					for (uint_t j = 0; j < op->num_params; j++) {
-						char* param = qk_param_str(op->params[j]);
-						qasm3 << param;
+					for (uint_t j = 0; j < op.num_params; j++) {
+						char* param = qk_param_str(op.params[j]);
+						// whole symbols are replaced by their identifiers
+						const char* last = param;
+						if (!renamed.empty()) {
+							Parameter::for_each_symbol(param, [&](const char* begin, const char* end) {
+								auto r = renamed.find(std::string(begin, end - begin));
+								if (r != renamed.end()) {
+									qasm3.write(last, begin - last);
+									qasm3 << r->second;
+									last = end;
+								}
+							});
+						}
+						qasm3 << last;
 						qk_str_free(param);
-						if (j != op->num_params - 1)
+						if (j != op.num_params - 1)
 							qasm3 << ", ";
 					}
 					qasm3 << ")";
 				}
-				if (op->num_qubits > 0) {
+				if (op.num_qubits > 0) {
 					qasm3 << " ";
-					for (uint_t j = 0; j < op->num_qubits; j++) {
-						qasm3 << qreg_name << "[" << op->qubits[j] << "]";
-						if (j != op->num_qubits - 1)
+					for (uint_t j = 0; j < op.num_qubits; j++) {
+						qasm3 << qreg_name << "[" << op.qubits[j] << "]";
+						if (j != op.num_qubits - 1)
 							qasm3 << ", ";
 					}
 				}
 				qasm3 << ";" << std::endl;
 			}
-			qk_circuit_instruction_clear(op);
 		}
 
 		return qasm3.str();
@@ -1902,45 +3329,39 @@ public:
 	/// @brief print circuit (this is for debug)
 	void print(void) const
 	{
-		uint_t nops;
-		nops = qk_circuit_num_instructions(rust_circuit_.get());
-
-		for (uint_t i = 0; i < nops; i++) {
-			QkOperationKind kind = qk_circuit_instruction_kind(rust_circuit_.get(), i);
-			QkCircuitInstruction *op = new QkCircuitInstruction;
-			qk_circuit_get_instruction(rust_circuit_.get(), i, op);
-			std::cout << op->name;
-			if (op->num_qubits > 0) {
+		for (auto inst : instructions()) {
+			const QkCircuitInstruction& op = inst.instruction();
+			std::cout << op.name;
+			if (op.num_qubits > 0) {
 				std::cout << "(";
-				for (uint_t j = 0; j < op->num_qubits; j++) {
-					std::cout << op->qubits[j];
-					if (j != op->num_qubits - 1)
+				for (uint_t j = 0; j < op.num_qubits; j++) {
+					std::cout << op.qubits[j];
+					if (j != op.num_qubits - 1)
 						std::cout << ", ";
 				}
 				std::cout << ") ";
 			}
-			if (op->num_clbits > 0) {
+			if (op.num_clbits > 0) {
 				std::cout << "(";
-				for (uint_t j = 0; j < op->num_clbits; j++) {
-					std::cout << op->clbits[j];
-					if (j != op->num_clbits - 1)
+				for (uint_t j = 0; j < op.num_clbits; j++) {
+					std::cout << op.clbits[j];
+					if (j != op.num_clbits - 1)
 						std::cout << ", ";
 				}
 				std::cout << ") ";
 			}
-			if (op->num_params > 0) {
+			if (op.num_params > 0) {
 				std::cout << "[";
-				for (uint_t j = 0; j < op->num_params; j++) {
-					char* param = qk_param_str(op->params[j]);
+				for (uint_t j = 0; j < op.num_params; j++) {
+					char* param = qk_param_str(op.params[j]);
 					std::cout << param;
 					qk_str_free(param);
-					if (j != op->num_params - 1)
+					if (j != op.num_params - 1)
 						std::cout << ", ";
 				}
 				std::cout << "]";
 			}
 			std::cout << std::endl;
-			qk_circuit_instruction_clear(op);
 		}
 	}
 
@@ -1958,87 +3379,569 @@ public:
 	}
 
 	/// @brief compare two circuits
+	/// @details Instructions are read through reused buffers, numeric parameters
+	///          are compared as doubles within QC_COMPARE_EPS and symbolic
+	///          parameters are compared structurally, so no memory is
+	///          allocated in this class while comparing. Matrices of
+	///          unitaries are compared if both are added through this class.
 	/// @param other a circuit to be compared with this circuit
+	/// @param diff_index if not nullptr, the index of the first instruction
+	///        that differs is stored here. If only the number of instructions
+	///        or the global phase differs, the number of common instructions
+	///        is stored.
 	/// @return true if two circuits are the same
-	bool operator==(const QuantumCircuit& other) const
+	bool equals(const QuantumCircuit& other, uint_t *diff_index = nullptr) const
 	{
-		if (global_phase_ != other.global_phase_) {
+		if (global_phase_ != other.global_phase_ && diff_index == nullptr) {
+			return false;
+		}
+		// copies sharing Rust's circuit
+		// (fingerprints are not compared, since parameters are compared within QC_COMPARE_EPS)
+		if (global_phase_ == other.global_phase_ && rust_circuit_ == other.rust_circuit_) {
+			return true;
+		}
+
+		uint_t nops = qk_circuit_num_instructions(rust_circuit_.get());
+		uint_t nops_other = qk_circuit_num_instructions(other.rust_circuit_.get());
+		if (nops != nops_other && diff_index == nullptr) {
 			return false;
 		}
 
-		// compare instructions
-		uint_t nops;
-		uint_t nops_other;
-		nops = qk_circuit_num_instructions(rust_circuit_.get());
-		nops_other = qk_circuit_num_instructions(other.rust_circuit_.get());
-		if (nops != nops_other) {
+		uint_t ncommon = std::min(nops, nops_other);
+		InstructionIterator it(rust_circuit_.get(), 0);
+		InstructionIterator it_other(other.rust_circuit_.get(), 0);
+		for (uint_t i = 0; i < ncommon; i++, ++it, ++it_other) {
+			if (!instruction_equals(it, it_other) || (it.kind() == QkOperationKind_Unitary && !unitary_equals(other, i))) {
+				if (diff_index != nullptr) {
+					*diff_index = i;
+				}
+				return false;
+			}
+		}
+		if (nops != nops_other || global_phase_ != other.global_phase_) {
+			if (diff_index != nullptr) {
+				*diff_index = ncommon;
+			}
 			return false;
 		}
+		return true;
+	}
+
+	/// @brief compare two circuits
+	/// @param other a circuit to be compared with this circuit
+	/// @return true if two circuits are the same
+	bool operator==(const QuantumCircuit& other) const
+	{
+		return equals(other);
+	}
+
+	bool operator!=(const QuantumCircuit& other) const
+	{
+		return !(*this == other);
+	}
+protected:
+	void add_pending_control_flow_op(void);
+
+	void pre_add_gate(void)
+	{
+		detach();
+		add_pending_control_flow_op();
+	}
+
+	/// @brief clone data shared with copies of this circuit before it is modified
+	void detach(void)
+	{
+		if (rust_circuit_ && rust_circuit_.use_count() > 1) {
+			rust_circuit_ = std::shared_ptr<rust_circuit>(qk_circuit_copy(rust_circuit_.get()), qk_circuit_free);
+		}
+		unshare(measure_map_);
+		unshare(unitary_ops_);
+		unshare(metrics_);
+		unshare(parameter_table_);
+	}
+
+	// wrappers of C-API to add an instruction and update the fingerprint
+
+	QkExitCode add_gate(const QkGate gate, const std::uint32_t *qubits, const double *params)
+	{
+		QkExitCode ret = qk_circuit_gate(rust_circuit_.get(), gate, qubits, params);
+		if (ret == QkExitCode_Success) {
+			const StandardGateInfo &info = standard_gate_info(gate);
+			record_operation(QkOperationKind_Gate, info.name, &info, qubits, info.num_qubits, nullptr, 0);
+			ops_fingerprint_.add((uint_t)info.num_params);
+			for (uint_t i = 0; i < info.num_params; i++) {
+				fingerprint_param(params[i]);
+			}
+		}
+		return ret;
+	}
+
+	QkExitCode add_parameterized_gate(const QkGate gate, const std::uint32_t *qubits, QkParam *const *params)
+	{
+		QkExitCode ret = qk_circuit_parameterized_gate(rust_circuit_.get(), gate, qubits, params);
+		if (ret == QkExitCode_Success) {
+			const StandardGateInfo &info = standard_gate_info(gate);
+			record_operation(QkOperationKind_Gate, info.name, &info, qubits, info.num_qubits, nullptr, 0);
+			ops_fingerprint_.add((uint_t)info.num_params);
+			if (info.num_params > 0) {
+				uint_t index = qk_circuit_num_instructions(rust_circuit_.get()) - 1;
+				for (uint_t i = 0; i < info.num_params; i++) {
+					record_param(params[i], index, i);
+				}
+			}
+		}
+		return ret;
+	}
 
-		for (uint_t i = 0; i < nops; i++) {
-			QkCircuitInstruction *op = new QkCircuitInstruction;
-			QkCircuitInstruction *op_other = new QkCircuitInstruction;
-			qk_circuit_get_instruction(rust_circuit_.get(), i, op);
-			qk_circuit_get_instruction(other.rust_circuit_.get(), i, op_other);
+	// add a gate with qk_circuit_gate if all parameters are real numbers
+	QkExitCode add_parameterized_gate(const QkGate gate, const std::uint32_t *qubits, const Parameter *const *params)
+	{
+		double values[4];
+		QkParam *qparams[4];
+		if (numeric_params(gate, params, values)) {
+			return add_gate(gate, qubits, values);
+		}
+		for (uint_t i = 0; i < standard_gate_info(gate).num_params; i++) {
+			qparams[i] = params[i]->qk_param();
+		}
+		return add_parameterized_gate(gate, qubits, qparams);
+	}
 
-			if (std::string(op->name) != std::string(op_other->name)) {
-				qk_circuit_instruction_clear(op);
-				qk_circuit_instruction_clear(op_other);
+	static bool numeric_params(const QkGate gate, const Parameter *const *params, double *values)
+	{
+		for (uint_t i = 0; i < standard_gate_info(gate).num_params; i++) {
+			if (!params[i]->is_real()) {
 				return false;
 			}
-			if (op->num_qubits != op_other->num_qubits || op->num_clbits != op_other->num_clbits || op->num_params != op_other->num_params) {
-				qk_circuit_instruction_clear(op);
-				qk_circuit_instruction_clear(op_other);
+			values[i] = params[i]->value_.real();
+		}
+		return true;
+	}
+
+	QkExitCode add_measure(const std::uint32_t qubit, const std::uint32_t clbit)
+	{
+		QkExitCode ret = qk_circuit_measure(rust_circuit_.get(), qubit, clbit);
+		if (ret == QkExitCode_Success) {
+			record_operation(QkOperationKind_Measure, "measure", nullptr, &qubit, 1, &clbit, 1);
+			ops_fingerprint_.add(0);
+		}
+		return ret;
+	}
+
+	QkExitCode add_reset(const std::uint32_t qubit)
+	{
+		QkExitCode ret = qk_circuit_reset(rust_circuit_.get(), qubit);
+		if (ret == QkExitCode_Success) {
+			record_operation(QkOperationKind_Reset, "reset", nullptr, &qubit, 1, nullptr, 0);
+			ops_fingerprint_.add(0);
+		}
+		return ret;
+	}
+
+	QkExitCode add_barrier(const std::uint32_t *qubits, const std::uint32_t num_qubits)
+	{
+		QkExitCode ret = qk_circuit_barrier(rust_circuit_.get(), qubits, num_qubits);
+		if (ret == QkExitCode_Success) {
+			record_operation(QkOperationKind_Barrier, "barrier", nullptr, qubits, num_qubits, nullptr, 0);
+			ops_fingerprint_.add(0);
+		}
+		return ret;
+	}
+
+	QkExitCode add_unitary(const std::shared_ptr<const std::vector<complex_t>> &mat, const std::uint32_t *qubits, const std::uint32_t num_qubits, const bool check_input)
+	{
+		uint_t index = qk_circuit_num_instructions(rust_circuit_.get());
+		QkExitCode ret = qk_circuit_unitary(rust_circuit_.get(), (const QkComplex64 *)mat->data(), qubits, num_qubits, check_input);
+		if (ret == QkExitCode_Success) {
+			unitary_ops_->push_back(std::make_pair(index, mat));
+			record_operation(QkOperationKind_Unitary, "unitary", nullptr, qubits, num_qubits, nullptr, 0);
+			ops_fingerprint_.add(0);
+			ops_fingerprint_.add(mat->size());
+			for (auto &v : *mat) {
+				ops_fingerprint_.add_double(v.real());
+				ops_fingerprint_.add_double(v.imag());
+			}
+		}
+		return ret;
+	}
+
+	// apply a single-qubit gate to each of qubits after checking all of them
+	void broadcast_gate(const QkGate gate, const reg_t &qubits, const double *params)
+	{
+		if (!check_qubits(qubits, standard_gate_info(gate).name)) {
+			return;
+		}
+		pre_add_gate();
+		std::uint32_t q;
+		for (auto qubit : qubits) {
+			q = (std::uint32_t)qubit;
+			add_gate(gate, &q, params);
+		}
+	}
+
+	void broadcast_parameterized_gate(const QkGate gate, const reg_t &qubits, QkParam *const *params)
+	{
+		if (!check_qubits(qubits, standard_gate_info(gate).name)) {
+			return;
+		}
+		pre_add_gate();
+		std::uint32_t q;
+		for (auto qubit : qubits) {
+			q = (std::uint32_t)qubit;
+			add_parameterized_gate(gate, &q, params);
+		}
+	}
+
+	void broadcast_parameterized_gate(const QkGate gate, const reg_t &qubits, const Parameter *const *params)
+	{
+		double values[4];
+		QkParam *qparams[4];
+		if (numeric_params(gate, params, values)) {
+			broadcast_gate(gate, qubits, values);
+			return;
+		}
+		for (uint_t i = 0; i < standard_gate_info(gate).num_params; i++) {
+			qparams[i] = params[i]->qk_param();
+		}
+		broadcast_parameterized_gate(gate, qubits, qparams);
+	}
+
+	bool check_qubits(const reg_t &qubits, const char *func) const
+	{
+		for (auto q : qubits) {
+			if (q >= num_qubits_) {
+				std::cerr << " QuantumCircuit::" << func << " : qubit " << q << " is out of range" << std::endl;
 				return false;
 			}
-			for (int j = 0; j < op->num_qubits; j++) {
-				if (op->qubits[j] != op_other->qubits[j]) {
-					qk_circuit_instruction_clear(op);
-					qk_circuit_instruction_clear(op_other);
-					return false;
+		}
+		return true;
+	}
+
+	static reg_t register_qubits(const QuantumRegister &qreg)
+	{
+		reg_t qubits(qreg.size());
+		for (uint_t i = 0; i < qubits.size(); i++) {
+			qubits[i] = qreg.base_index() + i;
+		}
+		return qubits;
+	}
+
+	// rebuild the circuit substituting values for symbols in one pass over instructions
+	bool bind_symbols(const std::unordered_map<std::string, double> &values)
+	{
+		add_pending_control_flow_op();
+		if (values.empty() || num_parameters() == 0) {
+			return true;
+		}
+
+		auto src = rust_circuit_;
+		auto src_unitaries = unitary_ops_;
+		auto src_table = parameter_table_;
+		uint_t nops = qk_circuit_num_instructions(src.get());
+
+		// mark slots referencing bound symbols and instructions with other symbols
+		// values of slots holding a bound symbol itself are taken without the C-API
+		enum { NUMERIC = 0, SYMBOLIC = 1, BOUND = 2 };
+		std::vector<std::uint8_t> state(nops, NUMERIC);
+		std::vector<std::pair<ParameterReference, double>> symbol_values;
+		bool any_bound = false;
+		for (auto &entry : *src_table) {
+			auto bind = values.find(entry.first);
+			bool bound = (bind != values.end());
+			any_bound |= bound;
+			for (auto &ref : entry.second) {
+				if (bound) {
+					state[ref.instruction] = BOUND;
+					if (ref.is_symbol) {
+						symbol_values.push_back(std::make_pair(ref, bind->second));
+					}
+				} else if (state[ref.instruction] == NUMERIC) {
+					state[ref.instruction] = SYMBOLIC;
 				}
 			}
-			for (int j = 0; j < op->num_params; j++) {
-				QkParam* sub = qk_param_zero();
-				qk_param_sub(sub, op->params[j], op_other->params[j]);
-				double diff = qk_param_as_real(sub);
-				qk_param_free(sub);
-				if (fabs(diff) > QC_COMPARE_EPS) {
-					qk_circuit_instruction_clear(op);
-					qk_circuit_instruction_clear(op_other);
-					return false;
+		}
+		if (!any_bound) {
+			return true;
+		}
+		std::sort(symbol_values.begin(), symbol_values.end(),
+				  [](const std::pair<ParameterReference, double> &a, const std::pair<ParameterReference, double> &b) { return a.first < b.first; });
+		uint_t symbol_pos = 0;
+
+		rust_circuit_ = empty_rust_circuit();
+		unitary_ops_ = std::make_shared<std::vector<std::pair<uint_t, std::shared_ptr<const std::vector<complex_t>>>>>();
+		measure_map_ = std::make_shared<std::vector<std::pair<uint_t, uint_t>>>();
+		metrics_ = std::make_shared<CircuitMetrics>();
+		parameter_table_ = std::make_shared<ParameterTable>();
+		ops_fingerprint_ = Fingerprint();
+		hashable_ = true;
+
+		bool all_bound = true;
+		std::vector<std::string> names;
+		std::unordered_map<std::string, std::shared_ptr<QkParam>> keys;
+		std::vector<const QkParam *> key_list;
+		std::vector<double> value_list;
+		std::vector<std::shared_ptr<QkParam>> bound_params;
+		CompiledExpression expr;
+		double dparams[4];
+		QkParam *pparams[4];
+		uint_t unitary_pos = 0;
+		InstructionIterator it(src.get(), 0);
+		for (uint_t i = 0; i < nops; i++, ++it) {
+			InstructionView inst = *it;
+			const QkCircuitInstruction &op = inst.instruction();
+			switch (inst.kind()) {
+			case QkOperationKind_Gate:
+			{
+				const StandardGateInfo *gate = inst.gate_info();
+				if (gate == nullptr) {
+					std::cerr << " QuantumCircuit::assign_parameters : non-standard gate " << op.name << " is lost" << std::endl;
+					break;
+				}
+				if (state[i] == SYMBOLIC) {
+					// no bound symbols in this instruction
+					add_parameterized_gate(gate->gate, op.qubits, op.params);
+					break;
+				}
+				bool numeric = true;
+				bound_params.clear();
+				for (uint_t j = 0; j < op.num_params; j++) {
+					pparams[j] = op.params[j];
+					if (symbol_pos < symbol_values.size() && symbol_values[symbol_pos].first.instruction == i && symbol_values[symbol_pos].first.slot == j) {
+						dparams[j] = symbol_values[symbol_pos++].second;
+						continue;
+					}
+					dparams[j] = qk_param_as_real(op.params[j]);
+					if (!std::isnan(dparams[j])) {
+						continue;
+					}
+					char *str = qk_param_str(op.params[j]);
+					names.clear();
+					Parameter::parse_symbols(str, names);
+					key_list.clear();
+					value_list.clear();
+					for (auto &name : names) {
+						auto v = values.find(name);
+						if (v != values.end()) {
+							auto key = keys.find(name);
+							if (key == keys.end()) {
+								key = keys.insert(std::make_pair(name, std::shared_ptr<QkParam>(qk_param_new_symbol(name.c_str()), qk_param_free))).first;
+							}
+							key_list.push_back(key->second.get());
+							value_list.push_back(v->second);
+						}
+					}
+					if (key_list.size() == names.size() && expr.compile(str, names)) {
+						// all symbols are bound, evaluate without the C-API
+						dparams[j] = expr.evaluate(value_list.data());
+						key_list.clear();
+					}
+					qk_str_free(str);
+					if (key_list.size() > 0) {
+#ifdef QISKIT_CAPI_HAS_SUBS
+						std::shared_ptr<QkParam> out(qk_param_zero(), qk_param_free);
+						if (qk_param_bind(out.get(), op.params[j], key_list.data(), value_list.data(), key_list.size()) == QkExitCode_Success) {
+							dparams[j] = qk_param_as_real(out.get());
+							pparams[j] = out.get();
+							bound_params.push_back(out);
+						} else {
+							all_bound = false;
+						}
+#else
+						std::cerr << " QuantumCircuit::assign_parameters : expression " << Parameter(qk_param_copy(op.params[j])) << " can not be bound without qk_param_bind" << std::endl;
+						all_bound = false;
+#endif
+					}
+					numeric &= !std::isnan(dparams[j]);
+				}
+				if (numeric) {
+					add_gate(gate->gate, op.qubits, dparams);
+				} else {
+					for (uint_t j = 0; j < op.num_params; j++) {
+						if (!std::isnan(dparams[j]) && std::isnan(qk_param_as_real(pparams[j]))) {
+							std::shared_ptr<QkParam> v(qk_param_from_double(dparams[j]), qk_param_free);
+							pparams[j] = v.get();
+							bound_params.push_back(v);
+						}
+					}
+					add_parameterized_gate(gate->gate, op.qubits, pparams);
+				}
+				break;
+			}
+			case QkOperationKind_Measure:
+				add_measure(op.qubits[0], op.clbits[0]);
+				measure_map_->push_back(std::pair<uint_t, uint_t>(op.qubits[0], op.clbits[0]));
+				break;
+			case QkOperationKind_Reset:
+				add_reset(op.qubits[0]);
+				break;
+			case QkOperationKind_Barrier:
+				add_barrier(op.qubits, op.num_qubits);
+				break;
+			case QkOperationKind_Unitary:
+			{
+				while (unitary_pos < src_unitaries->size() && (*src_unitaries)[unitary_pos].first < i) {
+					unitary_pos++;
+				}
+				if (unitary_pos < src_unitaries->size() && (*src_unitaries)[unitary_pos].first == i) {
+					add_unitary((*src_unitaries)[unitary_pos].second, op.qubits, op.num_qubits, false);
+				} else {
+					std::cerr << " QuantumCircuit::assign_parameters : matrix of unitary at " << i << " is not available" << std::endl;
 				}
+				break;
+			}
+			default:
+				std::cerr << " QuantumCircuit::assign_parameters : operation " << op.name << " is lost" << std::endl;
+				break;
 			}
-			for (int j = 0; j < op->num_clbits; j++) {
-				if (op->clbits[j] != op_other->clbits[j]) {
-					qk_circuit_instruction_clear(op);
-					qk_circuit_instruction_clear(op_other);
+		}
+		return all_bound;
+	}
+
+	void record_operation(const QkOperationKind kind, const char *name, const StandardGateInfo *gate, const std::uint32_t *qubits, const uint_t num_qubits,
+						  const std::uint32_t *clbits, const uint_t num_clbits)
+	{
+		metrics_->add(kind, name, gate, qubits, num_qubits, clbits, num_clbits);
+		ops_fingerprint_.add((uint_t)kind);
+		ops_fingerprint_.add_string(name);
+		ops_fingerprint_.add_array(qubits, num_qubits);
+		ops_fingerprint_.add_array(clbits, num_clbits);
+	}
+
+	void fingerprint_param(const double value)
+	{
+		ops_fingerprint_.add(0);
+		ops_fingerprint_.add_double(value);
+	}
+
+	// hash a parameter and add its symbols to the parameter table
+	void record_param(const QkParam *param, const uint_t instruction, const uint_t slot)
+	{
+		double value = qk_param_as_real(param);
+		if (!std::isnan(value)) {
+			fingerprint_param(value);
+			return;
+		}
+		// symbolic expression is hashed by its string form
+		char *str = qk_param_str(param);
+		ops_fingerprint_.add(1);
+		ops_fingerprint_.add_string(str);
+		std::vector<std::string> symbols;
+		Parameter::parse_symbols(str, symbols);
+		parameter_table_->add(instruction, slot, symbols, symbols.size() == 1 && symbols[0] == str);
+		qk_str_free(str);
+	}
+
+	static bool instruction_equals(const InstructionIterator &it, const InstructionIterator &it_other)
+	{
+		if (it.kind() != it_other.kind()) {
+			return false;
+		}
+		const QkCircuitInstruction& op = it.instruction();
+		const QkCircuitInstruction& op_other = it_other.instruction();
+		if (op.num_qubits != op_other.num_qubits || op.num_clbits != op_other.num_clbits || op.num_params != op_other.num_params) {
+			return false;
+		}
+		if (strcmp(op.name, op_other.name) != 0) {
+			return false;
+		}
+		if (op.num_qubits > 0 && memcmp(op.qubits, op_other.qubits, sizeof(std::uint32_t) * op.num_qubits) != 0) {
+			return false;
+		}
+		if (op.num_clbits > 0 && memcmp(op.clbits, op_other.clbits, sizeof(std::uint32_t) * op.num_clbits) != 0) {
+			return false;
+		}
+		for (uint_t j = 0; j < op.num_params; j++) {
+			double value = qk_param_as_real(op.params[j]);
+			double value_other = qk_param_as_real(op_other.params[j]);
+			if (std::isnan(value) || std::isnan(value_other)) {
+				// symbolic expression
+				if (!qk_param_equal(op.params[j], op_other.params[j])) {
 					return false;
 				}
+			} else if (fabs(value - value_other) > QC_COMPARE_EPS) {
+				return false;
 			}
 		}
 		return true;
 	}
 
-	bool operator!=(const QuantumCircuit& other) const
+	bool has_unitary_matrix(const uint_t index) const
 	{
-		return !(*this == other);
+		return unitary_matrix(index) != nullptr;
 	}
-protected:
-	void add_pending_control_flow_op(void);
 
-	void pre_add_gate(void)
+	// return the matrix of the unitary at index (nullptr if it is not recorded)
+	const std::vector<complex_t> *unitary_matrix(const uint_t index) const
 	{
-		add_pending_control_flow_op();
+		auto it = std::lower_bound(unitary_ops_->begin(), unitary_ops_->end(), index,
+								   [](const std::pair<uint_t, std::shared_ptr<const std::vector<complex_t>>> &op, const uint_t i) { return op.first < i; });
+		if (it == unitary_ops_->end() || it->first != index) {
+			return nullptr;
+		}
+		return it->second.get();
+	}
+
+	// compare matrices of unitaries at index within QC_COMPARE_EPS
+	// (unitaries are not compared if a matrix is not recorded, e.g. set by a transpiler)
+	bool unitary_equals(const QuantumCircuit &other, const uint_t index) const
+	{
+		const std::vector<complex_t> *mat = unitary_matrix(index);
+		const std::vector<complex_t> *mat_other = other.unitary_matrix(index);
+		if (mat == nullptr || mat_other == nullptr || mat == mat_other) {
+			return true;
+		}
+		if (mat->size() != mat_other->size()) {
+			return false;
+		}
+		for (uint_t j = 0; j < mat->size(); j++) {
+			if (std::abs((*mat)[j] - (*mat_other)[j]) > QC_COMPARE_EPS) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	/// @brief create a new Rust's circuit with the same registers as this circuit
+	std::shared_ptr<rust_circuit> empty_rust_circuit(void) const
+	{
+		uint_t nq = 0;
+		uint_t nc = 0;
+		for (auto &qreg : *qregs_) {
+			nq += qreg.size();
+		}
+		for (auto &creg : *cregs_) {
+			nc += creg.size();
+		}
+		if (nq != num_qubits_ || nc != num_clbits_) {
+			// registers do not cover the circuit set by a transpiler
+			return std::shared_ptr<rust_circuit>(qk_circuit_new((std::uint32_t)num_qubits_, (std::uint32_t)num_clbits_), qk_circuit_free);
+		}
+		std::shared_ptr<rust_circuit> circ(qk_circuit_new(0, 0), qk_circuit_free);
+		for (auto &qreg : *qregs_) {
+			qk_circuit_add_quantum_register(circ.get(), qreg.get_register().get());
+		}
+		for (auto &creg : *cregs_) {
+			qk_circuit_add_classical_register(circ.get(), creg.get_register().get());
+		}
+		return circ;
+	}
+
+	template <typename T>
+	static void unshare(std::shared_ptr<T> &data)
+	{
+		if (data.use_count() > 1) {
+			data = std::make_shared<T>(*data);
+		}
 	}
 
 	void get_qubits(reg_t &bits)
 	{
 		bits.clear();
 		bits.reserve(num_qubits_);
-		for (uint_t i = 0; i < qregs_.size(); i++) {
-			for (uint_t j = 0; j < qregs_[i].size(); j++) {
-				bits.push_back(qregs_[i][j]);
+		for (uint_t i = 0; i < qregs_->size(); i++) {
+			for (uint_t j = 0; j < (*qregs_)[i].size(); j++) {
+				// bits of a copied register refer to the source register, so use base index here
+				bits.push_back((*qregs_)[i].base_index() + j);
 			}
 		}
 	}
@@ -2047,9 +3950,9 @@ protected:
 	{
 		bits.clear();
 		bits.reserve(num_clbits_);
-		for (uint_t i = 0; i < cregs_.size(); i++) {
-			for (uint_t j = 0; j < cregs_[i].size(); j++) {
-				bits.push_back(cregs_[i][j]);
+		for (uint_t i = 0; i < cregs_->size(); i++) {
+			for (uint_t j = 0; j < (*cregs_)[i].size(); j++) {
+				bits.push_back((*cregs_)[i].base_index() + j);
 			}
 		}
 	}
@@ -35,7 +35,8 @@ namespace circuit {
 
 inline IfElseOp& QuantumCircuit::if_test(const uint32_t clbit, const uint32_t value, const std::function<void(QuantumCircuit &)> body)
 {
-    pre_add_gate();
+    // the parent circuit is not modified until the operation is added
+    add_pending_control_flow_op();
 
     auto op = std::shared_ptr<IfElseOp>(new IfElseOp(*this, clbit, value));
     pending_control_flow_op_ = op;
@@ -20,23 +20,37 @@
 #include "qiskit.h"
 #include "circuit/quantumcircuit.hpp"
 #include "providers/backend.hpp"
+#include "transpiler/transpile_cache.hpp"
+#include "transpiler/passmanager.hpp"
+#include "utils/thread_pool.hpp"
 
 namespace Qiskit {
 namespace compiler {
 
 /// @brief Return the transpiled circuit
 /// @param circ QuantumCircuit
-/// @param backend a backend used for transpiling
+/// @param target a target used for transpiling
 /// @param optimization_level level of optimization 0, 1, 2 or 3 (default = 2)
 /// @param seed_transpiler The seed for the transpiler (default = -1)
 /// @param approximation_degree The approximation degree a heurstic dial (default = 1.0)
+/// @param cache a cache of transpiled circuits (nullptr to always run the transpiler)
 /// @return transpiled QuantumCircuit
-inline circuit::QuantumCircuit transpile(circuit::QuantumCircuit &circ, providers::BackendV2 &backend, int optimization_level = 2, double approximation_degree = 1.0, int seed_transpiler = -1)
+inline circuit::QuantumCircuit transpile(circuit::QuantumCircuit &circ, transpiler::Target &target, int optimization_level = 2, double approximation_degree = 1.0, int seed_transpiler = -1, transpiler::TranspileCache *cache = nullptr)
 {
-    auto target = backend.target();
+    Fingerprint key;
+    if (cache != nullptr && target.is_hashable() && circ.is_hashable()) {
+        key = transpiler::TranspileCache::key(circ, target, optimization_level, approximation_degree, seed_transpiler);
+        circuit::QuantumCircuit transpiled = circ;
+        if (cache->load(key, transpiled)) {
+            return transpiled;
+        }
+    } else {
+        cache = nullptr;
+    }
+
     auto capi_target = target.rust_target();
     if (capi_target == nullptr) {
-        std::cerr << "transpile error : Target object for the backend is not valid." << std::endl;
+        std::cerr << "transpile error : Target object is not valid." << std::endl;
         return circ.copy();
     }
 
@@ -62,9 +76,61 @@ inline circuit::QuantumCircuit transpile(circuit::QuantumCircuit &circ, provider
     transpiled.set_qiskit_circuit(std::shared_ptr<rust_circuit>(result.circuit, qk_circuit_free), layout_map);
 
     qk_transpile_layout_free(result.layout);
+    if (cache != nullptr) {
+        cache->store(key, transpiled);
+    }
     return transpiled;
 }
 
+/// @brief Return the transpiled circuit
+/// @param circ QuantumCircuit
+/// @param backend a backend used for transpiling
+/// @param optimization_level level of optimization 0, 1, 2 or 3 (default = 2)
+/// @param seed_transpiler The seed for the transpiler (default = -1)
+/// @param approximation_degree The approximation degree a heurstic dial (default = 1.0)
+/// @param cache a cache of transpiled circuits (nullptr to always run the transpiler)
+/// @return transpiled QuantumCircuit
+inline circuit::QuantumCircuit transpile(circuit::QuantumCircuit &circ, providers::BackendV2 &backend, int optimization_level = 2, double approximation_degree = 1.0, int seed_transpiler = -1, transpiler::TranspileCache *cache = nullptr)
+{
+    auto target = backend.target();
+    return transpile(circ, target, optimization_level, approximation_degree, seed_transpiler, cache);
+}
+
+/// @brief Return the transpiled circuits in parallel
+/// @details The i-th circuit is transpiled with the seed
+///          StagedPassManager::derive_seed(seed_transpiler, i), so the output
+///          does not depend on the number of threads.
+/// @param circuits a list of QuantumCircuit
+/// @param backend a backend used for transpiling
+/// @param optimization_level level of optimization 0, 1, 2 or 3 (default = 2)
+/// @param seed_transpiler The seed for the transpiler (default = -1)
+/// @param approximation_degree The approximation degree a heurstic dial (default = 1.0)
+/// @param cache a cache of transpiled circuits (nullptr to always run the transpiler)
+/// @param pool a thread pool to run the transpiler (default = shared pool)
+/// @return a list of transpiled QuantumCircuit in the input order (copies of the inputs if the target is not valid)
+inline std::vector<circuit::QuantumCircuit> transpile(std::vector<circuit::QuantumCircuit> &circuits, providers::BackendV2 &backend, int optimization_level = 2, double approximation_degree = 1.0, int seed_transpiler = -1, transpiler::TranspileCache *cache = nullptr, ThreadPool &pool = ThreadPool::shared())
+{
+    std::vector<circuit::QuantumCircuit> output(circuits.size());
+    if (circuits.size() == 0) {
+        return output;
+    }
+    // build the Rust target and the hash of the target once before starting workers
+    auto target = backend.target();
+    if (target.rust_target() == nullptr) {
+        std::cerr << "transpile error : Target object is not valid." << std::endl;
+        return circuits;
+    }
+    if (cache != nullptr && target.is_hashable()) {
+        target.fingerprint();
+    }
+
+    pool.parallel_for(circuits.size(), [&](uint_t i) {
+        int seed = transpiler::StagedPassManager::derive_seed(seed_transpiler, i);
+        output[i] = transpile(circuits[i], target, optimization_level, approximation_degree, seed, cache);
+    });
+    return output;
+}
+
 } // namespace compiler
 } // namespace Qiskit
 
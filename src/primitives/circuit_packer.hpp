@@ -0,0 +1,267 @@
+/*
+# This code is part of Qiskit.
+#
+# (C) Copyright IBM 2026.
+#
+# This code is licensed under the Apache License, Version 2.0. You may
+# obtain a copy of this license in the LICENSE.txt file in the root directory
+# of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# Any modifications or derivative works of this code must retain this
+# copyright notice, and modified files need to carry a notice indicating
+# that they have been altered from the originals.
+*/
+
+// packing several small circuits into one wide circuit (multi-programming)
+
+#ifndef __qiskitcpp_primitives_circuit_packer_hpp__
+#define __qiskitcpp_primitives_circuit_packer_hpp__
+
+#include <algorithm>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "circuit/quantumcircuit.hpp"
+#include "transpiler/target.hpp"
+#include "transpiler/preset_passmanagers/generate_preset_pass_manager.hpp"
+#include "primitives/backend_sampler_v2.hpp"
+#include "primitives/containers/primitive_result.hpp"
+
+namespace Qiskit {
+namespace primitives {
+
+/// @class CircuitPacker
+/// @brief Pack several small circuits into one wide circuit for a backend.
+/// @details Each circuit is placed on a connected region of the coupling map
+///          and regions are kept apart by a given number of unused qubits.
+///          Each circuit is transpiled for the target restricted to its
+///          region, then all of them are composed into a circuit spanning
+///          the whole target with one classical register per circuit.
+///          Samples of the packed circuit are split back into one result
+///          per circuit.
+class CircuitPacker {
+protected:
+    transpiler::Target target_;
+    uint_t separation_;
+    int optimization_level_;
+    int seed_transpiler_;
+    std::vector<circuit::QuantumCircuit> circuits_;
+    std::vector<std::vector<uint32_t>> regions_;
+    std::vector<circuit::QuantumRegister> qregs_;    // registers of the packed circuit, bits refer to these objects
+    std::vector<circuit::ClassicalRegister> cregs_;
+    circuit::QuantumCircuit packed_;
+public:
+    /// @brief Create a new CircuitPacker
+    /// @param target target of the backend
+    /// @param separation minimum number of coupling map edges between qubits of different circuits
+    /// @param optimization_level optimization level used to transpile circuits
+    /// @param seed_transpiler the seed for the transpiler
+    CircuitPacker(const transpiler::Target &target, const uint_t separation = 2, const int optimization_level = 2, const int seed_transpiler = -1)
+        : target_(target), separation_(separation), optimization_level_(optimization_level), seed_transpiler_(seed_transpiler) {}
+
+    /// @brief Return regions of the packed circuits
+    /// @return a list of physical qubits for each circuit
+    const std::vector<std::vector<uint32_t>> &regions(void) const
+    {
+        return regions_;
+    }
+
+    /// @brief Return the packed circuit
+    /// @return the packed circuit, transpiled for the target
+    circuit::QuantumCircuit &packed_circuit(void)
+    {
+        return packed_;
+    }
+
+    /// @brief Find disjoint regions of the coupling map
+    /// @details Regions are grown by breadth first search from the lowest free
+    ///          qubit, for the largest circuit first. Qubits closer than
+    ///          separation edges to a region are not used for other regions.
+    /// @param coupling_map pairs of connected qubits
+    /// @param num_qubits number of qubits of the device
+    /// @param sizes number of qubits of each region
+    /// @param separation minimum number of edges between different regions
+    /// @param regions output regions in the order of sizes
+    /// @return true if all regions are found
+    static bool find_regions(const std::vector<std::pair<uint32_t, uint32_t>> &coupling_map, const uint_t num_qubits, const reg_t &sizes,
+                             const uint_t separation, std::vector<std::vector<uint32_t>> &regions)
+    {
+        std::vector<std::vector<uint32_t>> neighbors(num_qubits);
+        for (auto &edge : coupling_map) {
+            if (edge.first < num_qubits && edge.second < num_qubits) {
+                neighbors[edge.first].push_back(edge.second);
+                neighbors[edge.second].push_back(edge.first);
+            }
+        }
+
+        reg_t order(sizes.size());
+        for (uint_t i = 0; i < order.size(); i++) {
+            order[i] = i;
+        }
+        std::stable_sort(order.begin(), order.end(), [&sizes](uint_t a, uint_t b) { return sizes[a] > sizes[b]; });
+
+        regions.assign(sizes.size(), std::vector<uint32_t>());
+        std::vector<bool> blocked(num_qubits, false);
+        std::vector<bool> visited(num_qubits);
+        for (auto i : order) {
+            bool found = (sizes[i] == 0);
+            for (uint32_t seed = 0; seed < num_qubits && !found; seed++) {
+                if (blocked[seed]) {
+                    continue;
+                }
+                std::vector<uint32_t> region;
+                std::fill(visited.begin(), visited.end(), false);
+                std::deque<uint32_t> queue(1, seed);
+                visited[seed] = true;
+                while (!queue.empty() && region.size() < sizes[i]) {
+                    uint32_t q = queue.front();
+                    queue.pop_front();
+                    region.push_back(q);
+                    for (auto n : neighbors[q]) {
+                        if (!visited[n] && !blocked[n]) {
+                            visited[n] = true;
+                            queue.push_back(n);
+                        }
+                    }
+                }
+                if (region.size() == sizes[i]) {
+                    regions[i] = region;
+                    found = true;
+                }
+            }
+            if (!found) {
+                return false;
+            }
+
+            // block the region and qubits within separation
+            std::fill(visited.begin(), visited.end(), false);
+            std::vector<uint32_t> frontier(regions[i]);
+            for (auto q : frontier) {
+                visited[q] = true;
+                blocked[q] = true;
+            }
+            for (uint_t d = 0; d < separation; d++) {
+                std::vector<uint32_t> next;
+                for (auto q : frontier) {
+                    for (auto n : neighbors[q]) {
+                        if (!visited[n]) {
+                            visited[n] = true;
+                            blocked[n] = true;
+                            next.push_back(n);
+                        }
+                    }
+                }
+                frontier.swap(next);
+            }
+        }
+        return true;
+    }
+
+    /// @brief Pack circuits into one circuit
+    /// @param circuits a list of circuits to be packed
+    /// @return true if all circuits are packed
+    bool pack(const std::vector<circuit::QuantumCircuit> &circuits)
+    {
+        circuits_ = circuits;
+        reg_t sizes(circuits_.size());
+        for (uint_t i = 0; i < circuits_.size(); i++) {
+            sizes[i] = circuits_[i].num_qubits();
+        }
+        auto coupling_map = target_.coupling_map();
+        uint_t num_qubits = target_.num_qubits();
+        if (coupling_map.empty() || num_qubits == 0) {
+            std::cerr << " CircuitPacker Error : coupling map of the target is not available" << std::endl;
+            return false;
+        }
+        if (!find_regions(coupling_map, num_qubits, sizes, separation_, regions_)) {
+            std::cerr << " CircuitPacker Error : " << circuits_.size() << " circuits can not be placed on " << num_qubits << " qubits" << std::endl;
+            return false;
+        }
+
+        // one classical register for each circuit
+        qregs_.clear();
+        qregs_.reserve(1);
+        qregs_.emplace_back(num_qubits, std::string("q"));
+        cregs_.clear();
+        cregs_.reserve(circuits_.size());
+        for (uint_t i = 0; i < circuits_.size(); i++) {
+            if (circuits_[i].num_clbits() > 0) {
+                cregs_.emplace_back(circuits_[i].num_clbits(), register_name(i));
+            }
+        }
+        packed_ = circuit::QuantumCircuit(qregs_, cregs_);
+
+        reg_t clbits;
+        uint_t clbit_offset = 0;
+        for (uint_t i = 0; i < circuits_.size(); i++) {
+            auto sub_target = target_.subtarget(regions_[i]);
+            auto pm = transpiler::generate_preset_pass_manager(optimization_level_, sub_target, 1.0, seed_transpiler_);
+            auto transpiled = pm.run(circuits_[i]);
+            if (transpiled.num_qubits() > regions_[i].size()) {
+                std::cerr << " CircuitPacker Error : transpiled circuit " << i << " does not fit in its region" << std::endl;
+                return false;
+            }
+
+            reg_t qubits(regions_[i].begin(), regions_[i].end());
+            clbits.resize(circuits_[i].num_clbits());
+            for (uint_t j = 0; j < clbits.size(); j++) {
+                clbits[j] = clbit_offset + j;
+            }
+            clbit_offset += clbits.size();
+            packed_.compose(transpiled, qubits, clbits);
+        }
+        return true;
+    }
+
+    /// @brief Split result of the packed circuit
+    /// @param packed_result result of the packed circuit
+    /// @return results for each circuit with bits for the classical registers of the circuit
+    PrimitiveResult unpack(SamplerPubResult &packed_result)
+    {
+        PrimitiveResult result;
+        result.allocate(circuits_.size());
+        for (uint_t i = 0; i < circuits_.size(); i++) {
+            SamplerPub pub(circuits_[i]);
+            result[i].set_pub(pub);
+            if (circuits_[i].num_clbits() == 0) {
+                continue;
+            }
+            BitArray &bits = packed_result.data(register_name(i));
+            for (auto &creg : circuits_[i].cregs()) {
+                result[i].data(creg) = bits.get_subset(creg.base_index(), creg.size());
+            }
+        }
+        return result;
+    }
+
+    /// @brief Pack circuits, run them as a single pub and split the result
+    /// @param sampler a sampler to run the packed circuit
+    /// @param circuits a list of circuits to be packed
+    /// @return results for each circuit (empty if circuits can not be packed)
+    PrimitiveResult run(BackendSamplerV2 &sampler, const std::vector<circuit::QuantumCircuit> &circuits)
+    {
+        if (!pack(circuits)) {
+            return PrimitiveResult();
+        }
+        auto job = sampler.run({SamplerPub(packed_)});
+        if (job == nullptr) {
+            return PrimitiveResult();
+        }
+        auto packed_result = job->result();
+        if (packed_result.size() == 0) {
+            return PrimitiveResult();
+        }
+        return unpack(packed_result[0]);
+    }
+protected:
+    static std::string register_name(const uint_t i)
+    {
+        return std::string("pack") + std::to_string(i);
+    }
+};
+
+} // namespace primitives
+} // namespace Qiskit
+
+#endif  // __qiskitcpp_primitives_circuit_packer_hpp__
@@ -28,10 +28,13 @@ namespace primitives {
 
 /// @class BitArray
 /// @brief Stores an array of bit values.
+/// @details Samples of a pub with parameter bindings are stored for each
+///          binding in order, num_shots() samples per binding.
 class BitArray {
 protected:
     std::vector<BitVector> array_;
     uint_t num_bits_;
+    uint_t num_bindings_ = 1;
 public:
     /// @brief Create a new BitArray
     BitArray()
@@ -45,15 +48,18 @@ public:
     {
         array_ = src.array_;
         num_bits_ = src.num_bits_;
+        num_bindings_ = src.num_bindings_;
     }
 
     /// @brief Resize this BitArray with the specified num_samples and num_bits
-    /// @param num_samples number of samples (shots) saved in this array
+    /// @param num_samples number of samples (shots) saved in this array for each binding
     /// @param num_bits number of bits for each bitstring
-    void allocate(uint_t num_samples, uint_t num_bits)
+    /// @param num_bindings number of parameter bindings
+    void allocate(uint_t num_samples, uint_t num_bits, uint_t num_bindings = 1)
     {
-        array_.resize(num_samples, BitVector(num_bits));
+        array_.resize(num_samples * num_bindings, BitVector(num_bits));
         num_bits_ = num_bits;
+        num_bindings_ = num_bindings;
     }
 
     /// @brief Return the number of bits
@@ -74,7 +80,28 @@ public:
     /// @return The number of shots sampled from the register in each configuration.
     uint_t num_shots(void)
     {
-        return array_.size();
+        return array_.size() / num_bindings_;
+    }
+
+    /// @brief Return the number of parameter bindings
+    /// @return The number of configurations sampled in this array.
+    uint_t num_bindings(void)
+    {
+        return num_bindings_;
+    }
+
+    /// @brief Return samples of a parameter binding
+    /// @param index a flat index of the binding
+    /// @return A new BitArray with num_shots() samples
+    BitArray binding(const uint_t index)
+    {
+        BitArray ret;
+        ret.num_bits_ = num_bits_;
+        uint_t shots = num_shots();
+        if (index < num_bindings_) {
+            ret.array_.assign(array_.begin() + index * shots, array_.begin() + (index + 1) * shots);
+        }
+        return ret;
     }
 
     /// @brief accessing raw bit array
@@ -87,6 +114,7 @@ public:
     void from_samples(const reg_t& samples, uint_t num_bits)
     {
         num_bits_ = num_bits;
+        num_bindings_ = 1;
         array_.resize(samples.size());
         for (uint_t i = 0; i < samples.size(); i++) {
             array_[i].from_uint(samples[i], num_bits);
@@ -96,6 +124,7 @@ public:
     void from_samples(const uint_t* samples, uint_t num_samples, uint_t num_bits)
     {
         num_bits_ = num_bits;
+        num_bindings_ = 1;
         array_.resize(num_samples);
         for (uint_t i = 0; i < num_samples; i++) {
             array_[i].from_uint(samples[i], num_bits);
@@ -105,6 +134,7 @@ public:
     // from bitstring
     void from_bitstring(const std::vector<std::string>& samples)
     {
+        num_bindings_ = 1;
         array_.resize(samples.size());
         for (uint_t i = 0; i < samples.size(); i++) {
             array_[i].from_string(samples[i]);
@@ -119,7 +149,7 @@ public:
     BitArray get_subset(const uint_t start_bit, const uint_t num_bits)
     {
         BitArray ret;
-        ret.allocate(array_.size(), num_bits);
+        ret.allocate(num_shots(), num_bits, num_bindings_);
 
         for (uint_t i = 0; i < array_.size(); i++) {
             ret.array_[i] = array_[i].get_subset(start_bit, num_bits);
@@ -210,14 +240,43 @@ public:
     }
 
     /// @brief Set pub samples from json
+    /// @details samples of parameter bindings are nested arrays with the
+    ///          shape of bindings followed by the number of shots.
     /// @param input JSON input
     void from_json(nlohmann::ordered_json& input)
     {
-        auto samples = input["samples"];
+        auto& samples = input["samples"];
         auto num_bits = input["num_bits"];
-        auto num_shots = samples.size();
         if (num_bits_ == 0)
             num_bits_ = num_bits;
+        array_.clear();
+        num_bindings_ = 1;
+        uint_t num_shots = samples.size();
+        if (num_shots > 0 && samples[0].is_array()) {
+            // flatten samples of bindings
+            std::vector<const nlohmann::ordered_json*> shots_of_bindings;
+            std::vector<const nlohmann::ordered_json*> stack = {&samples};
+            while (!stack.empty()) {
+                const nlohmann::ordered_json* a = stack.back();
+                stack.pop_back();
+                if (a->size() > 0 && (*a)[0].is_array()) {
+                    for (uint_t i = a->size(); i > 0; i--) {
+                        stack.push_back(&(*a)[i - 1]);
+                    }
+                } else {
+                    shots_of_bindings.push_back(a);
+                }
+            }
+            num_bindings_ = shots_of_bindings.size();
+            num_shots = shots_of_bindings[0]->size();
+            array_.resize(num_shots * num_bindings_, BitVector(num_bits_));
+            for (uint_t b = 0; b < num_bindings_; b++) {
+                for (uint_t i = 0; i < num_shots && i < shots_of_bindings[b]->size(); i++) {
+                    array_[b * num_shots + i].from_hex_string((*shots_of_bindings[b])[i].get<std::string>());
+                }
+            }
+            return;
+        }
         allocate(num_shots, num_bits_);
         for (uint_t i = 0; i < num_shots; i++) {
             array_[i].from_hex_string(samples[i]);
@@ -20,6 +20,8 @@
 #include <nlohmann/json.hpp>
 using json = nlohmann::json;
 
+#include <algorithm>
+
 #include "circuit/quantumcircuit.hpp"
 
 
@@ -30,29 +32,116 @@ static circuit::QuantumCircuit default_circ;
 
 /// @class SamplerPub
 /// @brief Sampler Pub(Primitive Unified Bloc)
+/// @details A pub holds a circuit and an array of parameter values bound to
+///          the circuit. The array has the shape of bindings followed by the
+///          number of parameters, so one circuit is sampled for each binding.
 class SamplerPub {
 protected:
     circuit::QuantumCircuit circuit_;
-    //std::vector<std::string> params_;     //Parameter will be supported Qiskit 2.2 or higher
-    //std::vector<double> values_;
+    std::vector<std::string> params_;   // parameter names in the circuit order
+    std::vector<double> values_;        // parameter values in row-major order of (shape_, params_)
+    reg_t shape_;                       // shape of bindings
     uint_t shots_ = 0;
 public:
     /// @brief Create a new SamplerPub
     SamplerPub() {}
 
-    /*
     /// @brief Create a new SamplerPub
     /// @param circ a QuantumCircuit
     /// @param params parameter names
-    /// @param values parameter values
+    /// @param values parameter values, params.size() values for each binding
+    /// @param shots The total number of shots to sample for this sampler pub
+    SamplerPub(circuit::QuantumCircuit& circ, const std::vector<std::string>& params, const std::vector<double>& values, uint_t shots = 0)
+    {
+        circuit_ = circ;
+        shots_ = shots;
+        params_ = circuit_.parameter_names();
+        if (params.size() != params_.size() || (params.size() > 0 && values.size() % params.size() != 0)) {
+            std::cerr << " SamplerPub Error : " << values.size() << " values of " << params.size() << " parameters are given for a circuit with " << params_.size() << " parameters" << std::endl;
+            params_.clear();
+            return;
+        }
+        if (params_.size() == 0) {
+            return;
+        }
+        // reorder columns to the circuit order
+        std::vector<uint_t> column(params.size());
+        for (uint_t i = 0; i < params.size(); i++) {
+            auto it = std::find(params_.begin(), params_.end(), params[i]);
+            if (it == params_.end()) {
+                std::cerr << " SamplerPub Error : parameter " << params[i] << " is not in the circuit" << std::endl;
+                params_.clear();
+                return;
+            }
+            column[i] = it - params_.begin();
+        }
+        uint_t num_bindings = values.size() / params.size();
+        values_.resize(values.size());
+        for (uint_t b = 0; b < num_bindings; b++) {
+            for (uint_t i = 0; i < params.size(); i++) {
+                values_[b * params.size() + column[i]] = values[b * params.size() + i];
+            }
+        }
+        shape_ = reg_t({num_bindings});
+    }
+
+    /// @brief Create a new SamplerPub
+    /// @details values are broadcast to the shape; a single binding of
+    ///          values (num_parameters values) is repeated for all bindings.
+    /// @param circ a QuantumCircuit
+    /// @param values parameter values in the order of circ.parameter_names(), in row-major order of (shape, num_parameters)
+    /// @param shape shape of bindings
     /// @param shots The total number of shots to sample for this sampler pub
-    SamplerPub(circuit::QuantumCircuit& circ, std::vector<std::string> params, std::vector<double> values, uint_t shots) : circuit_(circ)
+    SamplerPub(circuit::QuantumCircuit& circ, const std::vector<double>& values, const reg_t& shape, uint_t shots = 0)
     {
-        params_ = params;
-        values_ = values;
+        circuit_ = circ;
         shots_ = shots;
+        params_ = circuit_.parameter_names();
+        uint_t num_bindings = 1;
+        for (auto n : shape) {
+            num_bindings *= n;
+        }
+        if (values.size() == num_bindings * params_.size()) {
+            values_ = values;
+        } else if (values.size() == params_.size()) {
+            values_.reserve(num_bindings * params_.size());
+            for (uint_t b = 0; b < num_bindings; b++) {
+                values_.insert(values_.end(), values.begin(), values.end());
+            }
+        } else {
+            std::cerr << " SamplerPub Error : " << values.size() << " values cannot be broadcast to " << num_bindings << " bindings of " << params_.size() << " parameters" << std::endl;
+            params_.clear();
+            return;
+        }
+        if (params_.size() > 0) {
+            shape_ = shape;
+        }
+    }
+
+    /// @brief Create a new SamplerPub
+    /// @param circ a QuantumCircuit
+    /// @param values a list of bindings, each has values in the order of circ.parameter_names()
+    /// @param shots The total number of shots to sample for this sampler pub
+    SamplerPub(circuit::QuantumCircuit& circ, const std::vector<std::vector<double>>& values, uint_t shots = 0)
+    {
+        circuit_ = circ;
+        shots_ = shots;
+        params_ = circuit_.parameter_names();
+        if (params_.size() == 0) {
+            return;
+        }
+        values_.reserve(values.size() * params_.size());
+        for (auto& binding : values) {
+            if (binding.size() != params_.size()) {
+                std::cerr << " SamplerPub Error : " << binding.size() << " values are given for " << params_.size() << " parameters" << std::endl;
+                params_.clear();
+                values_.clear();
+                return;
+            }
+            values_.insert(values_.end(), binding.begin(), binding.end());
+        }
+        shape_ = reg_t({values.size()});
     }
-    */
 
     /// @brief Create a new SamplerPub
     /// @param circ a QuantumCircuit
@@ -63,11 +152,23 @@ public:
         shots_ = shots;
     }
 
+    /// @brief Create a new SamplerPub taking a circuit
+    /// @param circ a QuantumCircuit to be moved
+    /// @param shots The total number of shots to sample for this sampler pub
+    SamplerPub(circuit::QuantumCircuit&& circ, uint_t shots = 0)
+    {
+        circuit_ = std::move(circ);
+        shots_ = shots;
+    }
+
     /// @brief Create a new SamplerPub as a copy of src.
     /// @param src a SamplerPub
     SamplerPub(const SamplerPub& src)
     {
         circuit_ = src.circuit_;
+        params_ = src.params_;
+        values_ = src.values_;
+        shape_ = src.shape_;
         shots_ = src.shots_;
     }
     ~SamplerPub(){}
@@ -79,19 +180,48 @@ public:
         return circuit_;
     }
 
-    /*
     /// @brief Return a list of parameter names for this sampler pub
-    std::vector<std::string>& params(void)
+    /// @return names in the order of values in each binding
+    const std::vector<std::string>& params(void) const
     {
         return params_;
     }
 
     /// @brief Return a list of parameter values for this sampler pub
-    std::vector<double>& values(void)
+    /// @return values in row-major order of (shape, number of parameters)
+    const std::vector<double>& values(void) const
     {
         return values_;
     }
-    */
+
+    /// @brief Return the shape of bindings
+    /// @return the shape (empty if the circuit has no parameters or a single binding)
+    const reg_t& shape(void) const
+    {
+        return shape_;
+    }
+
+    /// @brief Return the number of bindings
+    /// @return the number of circuits sampled for this pub
+    uint_t num_bindings(void) const
+    {
+        uint_t ret = 1;
+        for (auto n : shape_) {
+            ret *= n;
+        }
+        return ret;
+    }
+
+    /// @brief Return the circuit bound to values of a binding
+    /// @param index a flat index of the binding
+    /// @return a circuit without parameters
+    circuit::QuantumCircuit bound_circuit(const uint_t index) const
+    {
+        if (params_.size() == 0 || index >= num_bindings()) {
+            return circuit_;
+        }
+        return circuit_.bind_parameters(std::vector<double>(values_.begin() + index * params_.size(), values_.begin() + (index + 1) * params_.size()));
+    }
 
     /// @brief Return the total number of shots
     uint_t shots(void)
@@ -100,20 +230,63 @@ public:
     }
 
     /// @brief Return a JSON format of this sampler pub
+    /// @details The circuit is serialized once with parameters declared as
+    ///          inputs, and values are serialized as an array of the shape
+    ///          (shape, number of parameters).
     /// @return a JSON format sampler pub
     nlohmann::ordered_json to_json(void)
     {
-        // TO DO: insert parameters here when Parameter will be supported
         nlohmann::ordered_json params = json::array();
+        if (params_.size() > 0) {
+            // values are read in the sorted order of input names
+            std::vector<uint_t> order(params_.size());
+            std::vector<std::string> ids = circuit::QuantumCircuit::qasm3_identifiers(params_);
+            for (uint_t i = 0; i < params_.size(); i++) {
+                order[i] = i;
+            }
+            std::sort(order.begin(), order.end(), [&ids](uint_t a, uint_t b) { return circuit::Parameter::symbol_less(ids[a], ids[b]); });
+            uint_t pos = 0;
+            params = values_to_json(0, order, pos);
+        }
 
         if (shots_ > 0) {
             return json::array({circuit_.to_qasm3(), params, shots_});
         }
         return json::array({circuit_.to_qasm3(), params});
     }
-
+protected:
+    nlohmann::ordered_json values_to_json(const uint_t dim, const std::vector<uint_t>& order, uint_t& pos)
+    {
+        nlohmann::ordered_json ret = json::array();
+        if (dim == shape_.size()) {
+            for (auto i : order) {
+                ret.push_back(values_[pos + i]);
+            }
+            pos += order.size();
+            return ret;
+        }
+        for (uint_t i = 0; i < shape_[dim]; i++) {
+            ret.push_back(values_to_json(dim + 1, order, pos));
+        }
+        return ret;
+    }
 };
 
+/// @brief Make sampler pubs from a list of circuits
+/// @param circuits a list of circuits (e.g. from QuantumCircuit::bind_sweep), moved into pubs
+/// @param shots The total number of shots to sample for each pub
+/// @return a list of sampler pubs
+inline std::vector<SamplerPub> make_sampler_pubs(std::vector<circuit::QuantumCircuit>&& circuits, uint_t shots = 0)
+{
+    std::vector<SamplerPub> pubs;
+    pubs.reserve(circuits.size());
+    for (auto& circ : circuits) {
+        pubs.push_back(SamplerPub(std::move(circ), shots));
+    }
+    circuits.clear();
+    return pubs;
+}
+
 } // namespace primitives
 } // namespace Qiskit
 
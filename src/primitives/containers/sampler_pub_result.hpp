@@ -79,6 +79,31 @@ public:
         return data_[creg.name()];
     }
 
+    /// @brief Result data of a parameter binding.
+    /// @param name the name of the creg
+    /// @param index a flat index of the binding in the pub
+    /// @return the bitarray for the creg name sampled with the binding
+    BitArray data(const std::string& name, const uint_t index)
+    {
+        return data_[name].binding(index);
+    }
+
+    /// @brief Result data of a parameter binding.
+    /// @param creg the creg to be returned
+    /// @param index a flat index of the binding in the pub
+    /// @return the bitarray for the creg sampled with the binding
+    BitArray data(const circuit::ClassicalRegister& creg, const uint_t index)
+    {
+        return data_[creg.name()].binding(index);
+    }
+
+    /// @brief Return the number of parameter bindings
+    /// @return the number of bindings in the pub
+    uint_t num_bindings(void) const
+    {
+        return pub_.num_bindings();
+    }
+
     /// @brief get pub for this result
     /// @return pub
     const SamplerPub& pub(void) const
@@ -128,12 +153,12 @@ public:
     }
 
     /// @brief allocate bit array data
-    /// @param num_samples number of samples to be allocated
+    /// @param num_samples number of samples to be allocated for each binding
     void allocate(uint_t num_samples)
     {
         for (auto creg : pub_.circuit().cregs()) {
             data_[creg.name()] = BitArray();
-            data_[creg.name()].allocate(num_samples, creg.size());
+            data_[creg.name()].allocate(num_samples, creg.size(), pub_.num_bindings());
         }
     }
 
@@ -0,0 +1,477 @@
+/*
+# This code is part of Qiskit.
+#
+# (C) Copyright IBM 2026.
+#
+# This code is licensed under the Apache License, Version 2.0. You may
+# obtain a copy of this license in the LICENSE.txt file in the root directory
+# of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# Any modifications or derivative works of this code must retain this
+# copyright notice, and modified files need to carry a notice indicating
+# that they have been altered from the originals.
+*/
+
+// gradients of parameterized circuits by the parameter-shift rule
+
+#ifndef __qiskitcpp_primitives_parameter_shift_gradient_hpp__
+#define __qiskitcpp_primitives_parameter_shift_gradient_hpp__
+
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "circuit/quantumcircuit.hpp"
+#include "quantum_info/sparse_observable.hpp"
+#include "primitives/backend_sampler_v2.hpp"
+#include "primitives/containers/primitive_result.hpp"
+#include "utils/thread_pool.hpp"
+
+namespace Qiskit {
+namespace primitives {
+
+/// @class ParameterShiftGradient
+/// @brief Gradient of a parameterized circuit by the parameter-shift rule.
+/// @details Each occurrence of a parameter in a rotation gate (shift) is
+///          given its own symbol in template circuits, and the derivative is
+///          the sum over shifts of (f(x + pi/2) - f(x - pi/2)) / 2. All
+///          shifted circuits are bound from the templates and run as one
+///          batch of pubs, so the templates can be transpiled once.
+///          The function f is either a cost computed from sampled bits, or
+///          the expectation value of a SparseObservable; in the latter case
+///          terms are grouped by qubit-wise commuting measurement bases and
+///          one template is made for each group.
+class ParameterShiftGradient {
+protected:
+    // a term of the observable measured in a basis
+    struct Term {
+        double coeff;
+        std::vector<std::pair<uint32_t, QkBitTerm>> bits;
+    };
+
+    std::vector<std::string> names_;                    // parameters of the circuit
+    std::vector<uint_t> shift_params_;                  // parameter of each shift
+    std::vector<circuit::QuantumCircuit> templates_;    // one for each measurement basis
+    std::vector<std::vector<Term>> groups_;             // observable terms of each template
+    std::vector<circuit::QuantumRegister> qregs_;       // registers of templates, bits refer to these objects
+    std::vector<circuit::ClassicalRegister> cregs_;
+    bool observable_ = false;
+    bool valid_ = false;
+public:
+    /// @brief Create gradients of a cost computed from samples
+    /// @param circ a parameterized circuit with measurements
+    ParameterShiftGradient(const circuit::QuantumCircuit &circ)
+    {
+        qregs_.reserve(circ.qregs().size());
+        for (auto &qreg : circ.qregs()) {
+            qregs_.emplace_back(qreg.size(), qreg.name());
+        }
+        cregs_.reserve(circ.cregs().size());
+        for (auto &creg : circ.cregs()) {
+            cregs_.emplace_back(creg.size(), creg.name());
+        }
+        circuit::QuantumCircuit split(qregs_, cregs_);
+        valid_ = split_shifts(circ, split);
+        if (valid_) {
+            templates_.push_back(split);
+        }
+    }
+
+    /// @brief Create gradients of an expectation value
+    /// @param circ a parameterized circuit without measurements
+    /// @param obs an observable
+    ParameterShiftGradient(const circuit::QuantumCircuit &circ, const quantum_info::SparseObservable &obs)
+    {
+        observable_ = true;
+        if (obs.num_qubits() != circ.num_qubits()) {
+            std::cerr << " ParameterShiftGradient Error : observable of " << obs.num_qubits() << " qubits for a circuit of " << circ.num_qubits() << " qubits" << std::endl;
+            return;
+        }
+        qregs_.reserve(circ.qregs().size());
+        for (auto &qreg : circ.qregs()) {
+            qregs_.emplace_back(qreg.size(), qreg.name());
+        }
+        cregs_.reserve(1);
+        cregs_.emplace_back(circ.num_qubits(), std::string("meas"));
+        circuit::QuantumCircuit split(qregs_, cregs_);
+        if (!split_shifts(circ, split)) {
+            return;
+        }
+
+        // group terms measured in the same basis on each qubit
+        auto coeffs = obs.coeffs();
+        auto bit_terms = obs.bit_terms();
+        auto indices = obs.indices();
+        auto boundaries = obs.boundaries();
+        std::vector<std::vector<char>> bases;
+        for (uint_t t = 0; t < coeffs.size(); t++) {
+            Term term;
+            term.coeff = coeffs[t].real();
+            std::vector<char> basis(circ.num_qubits(), 0);
+            for (uint_t b = boundaries[t]; b < boundaries[t + 1]; b++) {
+                term.bits.push_back(std::make_pair((uint32_t)indices[b], bit_terms[b]));
+                basis[indices[b]] = measurement_basis(bit_terms[b]);
+            }
+            uint_t g = 0;
+            for (; g < bases.size(); g++) {
+                bool commute = true;
+                for (uint_t q = 0; q < basis.size() && commute; q++) {
+                    commute = (basis[q] == 0 || bases[g][q] == 0 || basis[q] == bases[g][q]);
+                }
+                if (commute) {
+                    break;
+                }
+            }
+            if (g == bases.size()) {
+                bases.push_back(std::vector<char>(basis.size(), 0));
+                groups_.push_back(std::vector<Term>());
+            }
+            for (uint_t q = 0; q < basis.size(); q++) {
+                if (basis[q] != 0) {
+                    bases[g][q] = basis[q];
+                }
+            }
+            groups_[g].push_back(term);
+        }
+
+        for (auto &basis : bases) {
+            circuit::QuantumCircuit measured = split;
+            for (uint_t q = 0; q < basis.size(); q++) {
+                if (basis[q] == 'X') {
+                    measured.h(q);
+                } else if (basis[q] == 'Y') {
+                    measured.sdg(q);
+                    measured.h(q);
+                }
+            }
+            for (uint_t q = 0; q < basis.size(); q++) {
+                if (basis[q] != 0) {
+                    measured.measure(q, q);
+                }
+            }
+            templates_.push_back(measured);
+        }
+        valid_ = true;
+    }
+
+    /// @brief Return if gradients can be computed
+    /// @return true if all parameters are in gates the shift rule applies to
+    bool is_valid(void) const
+    {
+        return valid_;
+    }
+
+    /// @brief Return names of parameters
+    /// @return names in the order of gradient vectors
+    const std::vector<std::string> &parameter_names(void) const
+    {
+        return names_;
+    }
+
+    /// @brief Return the number of shifts
+    /// @return the number of occurrences of parameters in the circuit
+    uint_t num_shifts(void) const
+    {
+        return shift_params_.size();
+    }
+
+    /// @brief Return the number of circuits run for a gradient
+    /// @return 2 x number of shifts x number of templates
+    uint_t num_circuits(void) const
+    {
+        return 2 * shift_params_.size() * templates_.size();
+    }
+
+    /// @brief Return template circuits
+    /// @details Templates can be replaced by transpiled circuits before
+    ///          making pubs.
+    /// @return a list of templates with one symbol for each shift
+    std::vector<circuit::QuantumCircuit> &templates(void)
+    {
+        return templates_;
+    }
+
+    /// @brief Make pubs of all shifted circuits
+    /// @param values values of parameters in the order of parameter_names()
+    /// @param shots the number of shots for each pub
+    /// @param pool a thread pool to bind circuits
+    /// @return a list of pubs, (+, -) pairs for each shift of each template
+    std::vector<SamplerPub> pubs(const std::vector<double> &values, const uint_t shots = 0, ThreadPool &pool = ThreadPool::shared())
+    {
+        std::vector<SamplerPub> ret;
+        if (!valid_) {
+            return ret;
+        }
+        if (values.size() != names_.size()) {
+            std::cerr << " ParameterShiftGradient Error : " << values.size() << " values are given for " << names_.size() << " parameters" << std::endl;
+            return ret;
+        }
+        const double shift = std::acos(-1.0) / 2.0;
+        uint_t num_sets = 2 * shift_params_.size();
+        ret.reserve(num_circuits());
+        for (auto &templ : templates_) {
+            // symbols of shifts remaining in the (transpiled) template
+            auto names = templ.parameter_names();
+            std::vector<uint_t> shifts(names.size());
+            for (uint_t i = 0; i < names.size(); i++) {
+                shifts[i] = shift_index(names[i]);
+                if (shifts[i] >= shift_params_.size()) {
+                    std::cerr << " ParameterShiftGradient Error : unknown parameter " << names[i] << " in template" << std::endl;
+                    return std::vector<SamplerPub>();
+                }
+            }
+            std::vector<double> sets(num_sets * names.size());
+            for (uint_t s = 0; s < num_sets; s++) {
+                double *set = sets.data() + s * names.size();
+                for (uint_t i = 0; i < names.size(); i++) {
+                    set[i] = values[shift_params_[shifts[i]]];
+                    if (shifts[i] == s / 2) {
+                        set[i] += (s % 2 == 0) ? shift : -shift;
+                    }
+                }
+            }
+            auto circuits = templ.bind_sweep(sets.data(), num_sets, names.size(), pool);
+            if (circuits.size() != num_sets) {
+                return std::vector<SamplerPub>();
+            }
+            for (auto &circ : circuits) {
+                ret.push_back(SamplerPub(std::move(circ), shots));
+            }
+        }
+        return ret;
+    }
+
+    /// @brief Compute gradient of a cost from results of pubs()
+    /// @param result results of pubs
+    /// @param cost a function returning cost from a pub result
+    /// @return gradient in the order of parameter_names() (empty on error)
+    std::vector<double> gradient(PrimitiveResult &result, const std::function<double(SamplerPubResult &)> &cost)
+    {
+        if (!check_result(result)) {
+            return std::vector<double>();
+        }
+        std::vector<double> grad(names_.size(), 0.0);
+        uint_t pos = 0;
+        for (uint_t t = 0; t < templates_.size(); t++) {
+            for (uint_t s = 0; s < shift_params_.size(); s++, pos += 2) {
+                grad[shift_params_[s]] += (cost(result[pos]) - cost(result[pos + 1])) / 2.0;
+            }
+        }
+        return grad;
+    }
+
+    /// @brief Compute gradient of the expectation value from results of pubs()
+    /// @param result results of pubs
+    /// @return gradient in the order of parameter_names() (empty on error)
+    std::vector<double> gradient(PrimitiveResult &result)
+    {
+        if (!observable_) {
+            std::cerr << " ParameterShiftGradient Error : no observable is given" << std::endl;
+            return std::vector<double>();
+        }
+        if (!check_result(result)) {
+            return std::vector<double>();
+        }
+        std::vector<double> grad(names_.size(), 0.0);
+        uint_t pos = 0;
+        for (uint_t t = 0; t < templates_.size(); t++) {
+            for (uint_t s = 0; s < shift_params_.size(); s++, pos += 2) {
+                double plus = expectation_value(groups_[t], result[pos].data("meas"));
+                double minus = expectation_value(groups_[t], result[pos + 1].data("meas"));
+                grad[shift_params_[s]] += (plus - minus) / 2.0;
+            }
+        }
+        return grad;
+    }
+
+    /// @brief Run all shifted circuits as one job and compute gradient of the expectation value
+    /// @param sampler a sampler to run circuits
+    /// @param values values of parameters in the order of parameter_names()
+    /// @return gradient in the order of parameter_names() (empty on error)
+    std::vector<double> run(BackendSamplerV2 &sampler, const std::vector<double> &values)
+    {
+        PrimitiveResult result;
+        if (!run_pubs(sampler, values, result)) {
+            return std::vector<double>();
+        }
+        return gradient(result);
+    }
+
+    /// @brief Run all shifted circuits as one job and compute gradient of a cost
+    /// @param sampler a sampler to run circuits
+    /// @param values values of parameters in the order of parameter_names()
+    /// @param cost a function returning cost from a pub result
+    /// @return gradient in the order of parameter_names() (empty on error)
+    std::vector<double> run(BackendSamplerV2 &sampler, const std::vector<double> &values, const std::function<double(SamplerPubResult &)> &cost)
+    {
+        PrimitiveResult result;
+        if (!run_pubs(sampler, values, result)) {
+            return std::vector<double>();
+        }
+        return gradient(result, cost);
+    }
+protected:
+    // expectation value of terms from samples of qubits in clbits of the same index
+    static double expectation_value(const std::vector<Term> &terms, BitArray &bits)
+    {
+        uint_t num_shots = bits.num_shots();
+        if (num_shots == 0) {
+            return 0.0;
+        }
+        double sum = 0.0;
+        for (uint_t shot = 0; shot < num_shots; shot++) {
+            const BitVector &sample = bits[shot];
+            for (auto &term : terms) {
+                double v = term.coeff;
+                for (auto &bit : term.bits) {
+                    uint_t b = sample.get(bit.first);
+                    switch (bit.second) {
+                    case QkBitTerm_X:
+                    case QkBitTerm_Y:
+                    case QkBitTerm_Z:
+                        v = b ? -v : v;
+                        break;
+                    case QkBitTerm_Plus:
+                    case QkBitTerm_Right:
+                    case QkBitTerm_Zero:
+                        v = b ? 0.0 : v;
+                        break;
+                    default:
+                        v = b ? v : 0.0;
+                        break;
+                    }
+                }
+                sum += v;
+            }
+        }
+        return sum / num_shots;
+    }
+
+    // copy circ to split giving each occurrence of parameters its own symbol
+    bool split_shifts(const circuit::QuantumCircuit &src, circuit::QuantumCircuit &split)
+    {
+        circuit::QuantumCircuit circ = src;
+        const circuit::ParameterTable &table = circ.parameter_table();
+        names_ = table.names();
+        std::map<std::pair<uint_t, uint_t>, uint_t> slots;
+        uint_t k = 0;
+        for (auto &entry : table) {
+            for (auto &ref : entry.second) {
+                if (!ref.is_symbol) {
+                    std::cerr << " ParameterShiftGradient Error : parameter " << entry.first << " is used in an expression" << std::endl;
+                    return false;
+                }
+                slots[std::make_pair(ref.instruction, ref.slot)] = k;
+            }
+            k++;
+        }
+
+        uint_t nops = circ.num_instructions();
+        for (uint_t i = 0; i < nops; i++) {
+            circuit::CircuitInstruction inst = circ[i];
+            circuit::Instruction op = inst.instruction();
+            if (op.name().empty()) {
+                std::cerr << " ParameterShiftGradient Error : instruction " << i << " is not supported" << std::endl;
+                return false;
+            }
+            std::vector<circuit::Parameter> params = op.params();
+            for (uint_t j = 0; j < params.size(); j++) {
+                auto slot = slots.find(std::make_pair(i, j));
+                if (slot == slots.end()) {
+                    continue;
+                }
+                if (!op.is_standard_gate() || !shiftable(op.gate_map(), j)) {
+                    std::cerr << " ParameterShiftGradient Error : parameter-shift rule does not apply to " << op.name() << std::endl;
+                    return false;
+                }
+                params[j] = circuit::Parameter(std::string("_ps[") + std::to_string(shift_params_.size()) + "]");
+                shift_params_.push_back(slot->second);
+            }
+            op.set_params(params);
+            split.append(circuit::CircuitInstruction(op, inst.qubits(), inst.clbits()));
+        }
+        return true;
+    }
+
+    // gates of the form exp(-i x G / 2) (up to phase) with eigenvalues of G in {-1, 1}
+    static bool shiftable(const QkGate gate, const uint_t slot)
+    {
+        switch (gate) {
+        case QkGate_RX:
+        case QkGate_RY:
+        case QkGate_RZ:
+        case QkGate_Phase:
+        case QkGate_U1:
+        case QkGate_U2:
+        case QkGate_U3:
+        case QkGate_U:
+        case QkGate_RXX:
+        case QkGate_RYY:
+        case QkGate_RZZ:
+        case QkGate_RZX:
+            return true;
+        case QkGate_R:
+            return slot == 0;
+        default:
+            return false;
+        }
+    }
+
+    static char measurement_basis(const QkBitTerm bit)
+    {
+        switch (bit) {
+        case QkBitTerm_X:
+        case QkBitTerm_Plus:
+        case QkBitTerm_Minus:
+            return 'X';
+        case QkBitTerm_Y:
+        case QkBitTerm_Right:
+        case QkBitTerm_Left:
+            return 'Y';
+        default:
+            return 'Z';
+        }
+    }
+
+    static uint_t shift_index(const std::string &name)
+    {
+        if (name.compare(0, 4, "_ps[") != 0) {
+            return (uint_t)-1;
+        }
+        return std::strtoul(name.c_str() + 4, nullptr, 10);
+    }
+
+    bool check_result(PrimitiveResult &result)
+    {
+        if (!valid_) {
+            return false;
+        }
+        if (result.size() != num_circuits()) {
+            std::cerr << " ParameterShiftGradient Error : " << result.size() << " results are given for " << num_circuits() << " circuits" << std::endl;
+            return false;
+        }
+        return true;
+    }
+
+    bool run_pubs(BackendSamplerV2 &sampler, const std::vector<double> &values, PrimitiveResult &result)
+    {
+        auto pubs = this->pubs(values);
+        if (pubs.size() != num_circuits()) {
+            return false;
+        }
+        auto job = sampler.run(pubs);
+        if (job == nullptr) {
+            return false;
+        }
+        result = job->result();
+        return true;
+    }
+};
+
+} // namespace primitives
+} // namespace Qiskit
+
+#endif  // __qiskitcpp_primitives_parameter_shift_gradient_hpp__
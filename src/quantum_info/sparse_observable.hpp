@@ -205,7 +205,7 @@ public:
     }
     std::vector<QkBitTerm> bit_terms(void) const
     {
-        std::vector<QkBitTerm> ret(num_terms());
+        std::vector<QkBitTerm> ret(obs_ ? qk_obs_len(obs_) : 0);
         if (obs_)
         {
             auto terms = qk_obs_bit_terms(obs_);
@@ -244,7 +244,7 @@ public:
     }
     reg_t boundaries(void) const
     {
-        reg_t ret(qk_obs_len(obs_));
+        reg_t ret(obs_ ? num_terms() + 1 : 0);
         if (obs_)
         {
             auto idx = qk_obs_boundaries(obs_);
@@ -0,0 +1,102 @@
+/*
+# This code is part of Qiskit.
+#
+# (C) Copyright IBM 2026.
+#
+# This code is licensed under the Apache License, Version 2.0. You may
+# obtain a copy of this license in the LICENSE.txt file in the root directory
+# of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# Any modifications or derivative works of this code must retain this
+# copyright notice, and modified files need to carry a notice indicating
+# that they have been altered from the originals.
+*/
+
+// base classes of user-defined transpiler passes
+
+#ifndef __qiskitcpp_transpiler_basepasses_hpp__
+#define __qiskitcpp_transpiler_basepasses_hpp__
+
+#include <string>
+
+#include "qiskit.h"
+
+namespace Qiskit {
+namespace transpiler {
+
+/// @class BasePass
+/// @brief Base class of passes run by StagedPassManager before or after a stage.
+/// @details A pass works on the DAG shared with the stages, so no conversion
+///          between a circuit and a DAG is made for the pass. The stage state
+///          holds the layout and is nullptr until a stage creates it (e.g.
+///          before the layout stage).
+class BasePass {
+public:
+    virtual ~BasePass() {}
+
+    /// @brief Return the name of the pass used in messages and statistics
+    /// @return name of the pass
+    virtual std::string name(void) const = 0;
+
+    /// @brief Return if the pass does not modify the DAG
+    /// @return true for an analysis pass
+    virtual bool is_analysis_pass(void) const = 0;
+
+    /// @brief Run the pass
+    /// @param dag the DAG of the circuit being transpiled
+    /// @param target the target of the transpilation
+    /// @param state the state of stages (can be nullptr)
+    /// @return true if the pass succeeds
+    virtual bool run(QkDag *dag, const QkTarget *target, QkTranspilerStageState *state) = 0;
+};
+
+/// @class AnalysisPass
+/// @brief A pass reading the DAG without modifying it.
+/// @details Results of the analysis are kept by the pass, and need to be
+///          guarded if a list of circuits is run in parallel.
+class AnalysisPass : public BasePass {
+public:
+    bool is_analysis_pass(void) const override
+    {
+        return true;
+    }
+
+    bool run(QkDag *dag, const QkTarget *target, QkTranspilerStageState *state) override final
+    {
+        return analyze(dag, target, state);
+    }
+
+    /// @brief Analyze the DAG
+    /// @param dag the DAG of the circuit being transpiled
+    /// @param target the target of the transpilation
+    /// @param state the state of stages (can be nullptr)
+    /// @return true if the analysis succeeds
+    virtual bool analyze(const QkDag *dag, const QkTarget *target, QkTranspilerStageState *state) = 0;
+};
+
+/// @class TransformationPass
+/// @brief A pass rewriting the DAG in place.
+class TransformationPass : public BasePass {
+public:
+    bool is_analysis_pass(void) const override
+    {
+        return false;
+    }
+
+    bool run(QkDag *dag, const QkTarget *target, QkTranspilerStageState *state) override final
+    {
+        return transform(dag, target, state);
+    }
+
+    /// @brief Rewrite the DAG
+    /// @param dag the DAG of the circuit being transpiled
+    /// @param target the target of the transpilation
+    /// @param state the state of stages (can be nullptr)
+    /// @return true if the transformation succeeds
+    virtual bool transform(QkDag *dag, const QkTarget *target, QkTranspilerStageState *state) = 0;
+};
+
+} // namespace transpiler
+} // namespace Qiskit
+
+#endif  // __qiskitcpp_transpiler_basepasses_hpp__
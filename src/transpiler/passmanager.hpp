@@ -17,12 +17,23 @@
 #ifndef __qiskitcpp_transpiler_passmanager_def_hpp__
 #define __qiskitcpp_transpiler_passmanager_def_hpp__
 
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <memory>
+
 #include "utils/types.hpp"
 #include "qiskit.h"
 
 #include "circuit/quantumcircuit.hpp"
 #include "providers/backend.hpp"
 #include "transpiler/target.hpp"
+#include "transpiler/basepasses.hpp"
+#include "transpiler/transpile_cache.hpp"
+#include "transpiler/transpiled_template.hpp"
+#include "transpiler/transpile_stats.hpp"
+#include "transpiler/scheduling.hpp"
+#include "utils/thread_pool.hpp"
 
 namespace Qiskit
 {
@@ -55,6 +66,7 @@ public:
     virtual std::vector<circuit::QuantumCircuit> run(std::vector<circuit::QuantumCircuit>& circuits)
     {
         std::vector<circuit::QuantumCircuit> output;
+        output.reserve(circuits.size());
         for (auto &circ : circuits) {
             output.push_back(run(circ));
         }
@@ -73,6 +85,10 @@ protected:
     uint8_t optimization_level_ = 2;
     double approximation_degree_ = 1.0;
     int seed_transpiler_ = -1;
+    TranspileCache *cache_ = nullptr;
+    SchedulingMethod scheduling_method_ = SchedulingMethod::NONE;
+    std::map<std::string, std::vector<std::shared_ptr<BasePass>>> passes_before_;   // user passes run before each stage
+    std::map<std::string, std::vector<std::shared_ptr<BasePass>>> passes_after_;    // user passes run after each stage
 public:
     /// @brief Create a new StagedPassManager
     StagedPassManager() {}
@@ -84,6 +100,10 @@ public:
         optimization_level_ = other.optimization_level_;
         approximation_degree_ = other.approximation_degree_;
         seed_transpiler_ = other.seed_transpiler_;
+        cache_ = other.cache_;
+        scheduling_method_ = other.scheduling_method_;
+        passes_before_ = other.passes_before_;
+        passes_after_ = other.passes_after_;
     }
 
     /// @brief Create a new StagedPassManager
@@ -114,19 +134,212 @@ public:
     {
     }
 
+    /// @brief Set a cache of transpiled circuits
+    /// @param cache a cache used by run (nullptr to always run the transpiler)
+    void set_cache(TranspileCache *cache)
+    {
+        cache_ = cache;
+    }
+
+    /// @brief Return the cache of transpiled circuits
+    /// @return pointer to the cache (nullptr if not set)
+    TranspileCache *cache(void) const
+    {
+        return cache_;
+    }
+
+    /// @brief Set the method of the scheduling stage
+    /// @details If a method is set and the scheduling stage is in this pass
+    ///          manager, output circuits are scheduled with durations of
+    ///          instructions in the target (see transpiler::schedule), and
+    ///          QuantumCircuit::op_start_times and QuantumCircuit::duration
+    ///          are set. Durations are not available for a target made from
+    ///          a Rust target.
+    /// @param method ASAP, ALAP or NONE to skip scheduling (default)
+    void set_scheduling_method(const SchedulingMethod method)
+    {
+        scheduling_method_ = method;
+    }
+
+    /// @brief Return the method of the scheduling stage
+    /// @return the scheduling method
+    SchedulingMethod scheduling_method(void) const
+    {
+        return scheduling_method_;
+    }
+
+    /// @brief Add a pass run before a stage
+    /// @details Passes added to the same stage are run in the order added.
+    ///          Passes are shared by copies of this pass manager, and are
+    ///          called from several threads when a list of circuits is run.
+    /// @param stage name of a stage of this pass manager
+    /// @param pass a pass
+    /// @return true if the stage is found
+    bool add_pass_before(const std::string& stage, std::shared_ptr<BasePass> pass)
+    {
+        if (!has_stage(stage)) {
+            std::cerr << "StagedPassManager Error : stage " << stage << " is not in the pass manager" << std::endl;
+            return false;
+        }
+        passes_before_[stage].push_back(pass);
+        return true;
+    }
+
+    /// @brief Add a pass run after a stage
+    /// @details Passes added to the same stage are run in the order added.
+    ///          Passes are shared by copies of this pass manager, and are
+    ///          called from several threads when a list of circuits is run.
+    /// @param stage name of a stage of this pass manager
+    /// @param pass a pass
+    /// @return true if the stage is found
+    bool add_pass_after(const std::string& stage, std::shared_ptr<BasePass> pass)
+    {
+        if (!has_stage(stage)) {
+            std::cerr << "StagedPassManager Error : stage " << stage << " is not in the pass manager" << std::endl;
+            return false;
+        }
+        passes_after_[stage].push_back(pass);
+        return true;
+    }
+
+    /// @brief Remove all passes added before or after stages
+    void clear_passes(void)
+    {
+        passes_before_.clear();
+        passes_after_.clear();
+    }
+
+    /// @brief Check if passes are added before or after stages
+    /// @return true if a pass is added
+    bool has_passes(void) const
+    {
+        return !passes_before_.empty() || !passes_after_.empty();
+    }
 
+    /// @brief Run stages on a circuit
+    /// @details If a cache is set, a transpiled circuit of the same input is
+    ///          taken from the cache without running the transpiler. The
+    ///          cache is not used if passes are added.
+    /// @param circ an input quantum circuit
+    /// @return a new quantum circuit
     circuit::QuantumCircuit run(circuit::QuantumCircuit& circ) override
     {
+        return run_with_seed(circ, seed_transpiler_);
+    }
+
+    /// @brief Run stages on a circuit and record statistics of each stage
+    /// @details Stages are run one by one, also for the default stages which
+    ///          are otherwise run by a single call of the transpiler, and the
+    ///          cache is not used. The circuit is converted from the DAG after
+    ///          each stage to take metrics, which is not counted in the time.
+    ///          Added passes are recorded with their names.
+    /// @param circ an input quantum circuit
+    /// @param stats statistics set for the stages run
+    /// @return a new quantum circuit
+    circuit::QuantumCircuit run(circuit::QuantumCircuit& circ, TranspileStats& stats)
+    {
+        bool success;
+        stats.clear();
+        return transpile(circ, seed_transpiler_, success, &stats);
+    }
+
+    /// @brief Run stages on a parameterized circuit once for all bindings
+    /// @details The circuit is transpiled with unbound parameters, and values
+    ///          are bound to the returned template without running the
+    ///          transpiler again.
+    /// @param circ an input quantum circuit with unbound parameters
+    /// @return a transpiled template
+    TranspiledTemplate run_template(circuit::QuantumCircuit& circ)
+    {
+        std::vector<std::string> names = circ.parameter_names();
+        return TranspiledTemplate(names, run(circ));
+    }
+
+    /// @brief Run stages on a list of circuits in parallel on the shared thread pool
+    /// @param circuits a list of input quantum circuits
+    /// @return a list of output quantum circuits in the input order
+    std::vector<circuit::QuantumCircuit> run(std::vector<circuit::QuantumCircuit>& circuits) override
+    {
+        return run(circuits, ThreadPool::shared());
+    }
+
+    /// @brief Run stages on a list of circuits in parallel
+    /// @details The i-th circuit is transpiled with the seed derive_seed(seed_transpiler, i),
+    ///          so the output does not depend on the number of threads.
+    /// @param circuits a list of input quantum circuits
+    /// @param pool a thread pool to run the transpiler
+    /// @return a list of output quantum circuits in the input order (copies of the inputs if the target is not valid)
+    std::vector<circuit::QuantumCircuit> run(std::vector<circuit::QuantumCircuit>& circuits, ThreadPool& pool)
+    {
+        if (circuits.size() == 0) {
+            return std::vector<circuit::QuantumCircuit>();
+        }
+        // build the Rust target and the hash of the target before starting workers
+        if (target_.rust_target() == nullptr) {
+            std::cerr << "StagedPassManager Error : Target object is not valid." << std::endl;
+            return circuits;
+        }
+        if (cache_ != nullptr && target_.is_hashable()) {
+            target_.fingerprint();
+        }
+        std::vector<circuit::QuantumCircuit> output(circuits.size());
+        pool.parallel_for(circuits.size(), [this, &circuits, &output](uint_t i) {
+            output[i] = run_with_seed(circuits[i], derive_seed(seed_transpiler_, i));
+        });
+        return output;
+    }
+
+    /// @brief Return the seed for a circuit in a list
+    /// @details A negative seed (not deterministic) is returned as it is.
+    /// @param seed the seed for the transpiler
+    /// @param index the index of the circuit in the list
+    /// @return a non-negative seed for the circuit
+    static int derive_seed(const int seed, const uint_t index)
+    {
+        if (seed < 0) {
+            return seed;
+        }
+        Fingerprint fp;
+        fp.add((std::uint64_t)seed);
+        fp.add((std::uint64_t)index);
+        return (int)(fp.low() & 0x7fffffff);
+    }
+protected:
+    // run stages with the seed, using the cache if it is set
+    circuit::QuantumCircuit run_with_seed(circuit::QuantumCircuit& circ, const int seed)
+    {
+        bool success;
+        if (cache_ == nullptr || !target_.is_hashable() || !circ.is_hashable() || has_passes()) {
+            return transpile(circ, seed, success);
+        }
+        Fingerprint key = TranspileCache::key(circ, target_, optimization_level_, approximation_degree_, seed, stages_);
+        circuit::QuantumCircuit transpiled = circ;
+        if (cache_->load(key, transpiled)) {
+            schedule_output(transpiled, nullptr);
+            return transpiled;
+        }
+        transpiled = transpile(circ, seed, success);
+        if (success) {
+            cache_->store(key, transpiled);
+        }
+        return transpiled;
+    }
+
+    // run stages, success is set to false if the transpiler fails and a copy of circ is returned
+    // statistics of each stage are added to stats if it is not nullptr
+    circuit::QuantumCircuit transpile(circuit::QuantumCircuit& circ, const int seed, bool& success, TranspileStats* stats = nullptr)
+    {
+        success = false;
         QkTranspileOptions options = qk_transpiler_default_options();
         options.optimization_level = optimization_level_;
         options.approximation_degree = approximation_degree_;
-        if (seed_transpiler_ >= 0) {
-            options.seed = seed_transpiler_;
+        if (seed >= 0) {
+            options.seed = seed;
         }
         char *error;
         QkExitCode ret;
 
-        if (stages_.size() == 6) {
+        if (stages_.size() == 6 && stats == nullptr && !has_passes()) {
             if (stages_[0] == "init" && stages_[1] == "layout" && stages_[2] == "routing" &&
                 stages_[3] == "translation" && stages_[4] == "optimization" && stages_[5] == "scheduling") {
                 // use default transpiler
@@ -146,6 +359,8 @@ public:
                 transpiled.set_qiskit_circuit(std::shared_ptr<rust_circuit>(result.circuit, qk_circuit_free), layout_map);
 
                 qk_transpile_layout_free(result.layout);
+                schedule_output(transpiled, nullptr);
+                success = true;
                 return transpiled;
             }
         }
@@ -155,8 +370,21 @@ public:
             return circ.copy();
         }
         QkTranspilerStageState* state = nullptr;
+        circuit::CircuitMetrics before;
+        if (stats != nullptr) {
+            before = circ.metrics();
+        }
 
         for (auto stage : stages_) {
+            if (!run_passes(passes_before_, stage, dag, state, stats, before)) {
+                qk_dag_free(dag);
+                if (state) {
+                    qk_transpile_state_free(state);
+                }
+                return circ.copy();
+            }
+            auto start = std::chrono::steady_clock::now();
+            bool ran = true;
             if (stage == "init") {
                 ret = qk_transpile_stage_init(dag, target_.rust_target(), &options, &state, &error);
                 if (ret != QkExitCode_Success) {
@@ -205,10 +433,27 @@ public:
                     std::cerr << "StagedPassManager Error in optimization stage (" << ret << ") : " << error << std::endl;
                 }
             } else if (stage == "scheduling") {
-                // to be implemented (?) in C-API
+                // the output circuit is scheduled after the DAG is converted
+                ran = false;
+            } else {
+                ran = false;
+            }
+            if (stats != nullptr && ran) {
+                std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+                circuit::CircuitMetrics after = dag_metrics(dag);
+                stats->add(stage, time.count(), before, after);
+                before = after;
+            }
+            if (!run_passes(passes_after_, stage, dag, state, stats, before)) {
+                qk_dag_free(dag);
+                if (state) {
+                    qk_transpile_state_free(state);
+                }
+                return circ.copy();
             }
         }
         QkCircuit* result_circ = qk_dag_to_circuit(dag);
+        qk_dag_free(dag);
 
         circuit::QuantumCircuit transpiled = circ;
         if (state) {
@@ -224,8 +469,65 @@ public:
             transpiled.set_qiskit_circuit(std::shared_ptr<rust_circuit>(result_circ, qk_circuit_free), layout_map);
         }
 
+        schedule_output(transpiled, stats);
+        success = true;
         return transpiled;
     }
+
+    // schedule the output circuit if the scheduling stage is run
+    void schedule_output(circuit::QuantumCircuit& transpiled, TranspileStats* stats)
+    {
+        if (scheduling_method_ == SchedulingMethod::NONE || !has_stage("scheduling")) {
+            return;
+        }
+        auto start = std::chrono::steady_clock::now();
+        schedule(transpiled, target_, scheduling_method_);
+        if (stats != nullptr) {
+            std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+            stats->add("scheduling", time.count(), transpiled.metrics(), transpiled.metrics());
+        }
+    }
+
+    // run passes added to the stage, statistics of each pass are added to stats if it is not nullptr
+    bool run_passes(const std::map<std::string, std::vector<std::shared_ptr<BasePass>>>& passes, const std::string& stage, QkDag* dag,
+                    QkTranspilerStageState* state, TranspileStats* stats, circuit::CircuitMetrics& before)
+    {
+        auto it = passes.find(stage);
+        if (it == passes.end()) {
+            return true;
+        }
+        for (auto& pass : it->second) {
+            auto start = std::chrono::steady_clock::now();
+            if (!pass->run(dag, target_.rust_target(), state)) {
+                std::cerr << "StagedPassManager Error in pass " << pass->name() << " at " << stage << " stage" << std::endl;
+                return false;
+            }
+            if (stats != nullptr) {
+                std::chrono::duration<double> time = std::chrono::steady_clock::now() - start;
+                if (pass->is_analysis_pass()) {
+                    stats->add(pass->name(), time.count(), before, before);
+                } else {
+                    circuit::CircuitMetrics after = dag_metrics(dag);
+                    stats->add(pass->name(), time.count(), before, after);
+                    before = after;
+                }
+            }
+        }
+        return true;
+    }
+
+    bool has_stage(const std::string& stage) const
+    {
+        return std::find(stages_.begin(), stages_.end(), stage) != stages_.end();
+    }
+
+    // metrics of the circuit in a DAG
+    static circuit::CircuitMetrics dag_metrics(QkDag* dag)
+    {
+        circuit::QuantumCircuit circ;
+        circ.set_qiskit_circuit(std::shared_ptr<rust_circuit>(qk_dag_to_circuit(dag), qk_circuit_free), std::vector<uint32_t>());
+        return circ.metrics();
+    }
 };
 
 
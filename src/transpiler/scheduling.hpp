@@ -0,0 +1,321 @@
+/*
+# This code is part of Qiskit.
+#
+# (C) Copyright IBM 2026.
+#
+# This code is licensed under the Apache License, Version 2.0. You may
+# obtain a copy of this license in the LICENSE.txt file in the root directory
+# of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# Any modifications or derivative works of this code must retain this
+# copyright notice, and modified files need to carry a notice indicating
+# that they have been altered from the originals.
+*/
+
+// ASAP / ALAP scheduling of circuits with instruction durations of a target
+
+#ifndef __qiskitcpp_transpiler_scheduling_hpp__
+#define __qiskitcpp_transpiler_scheduling_hpp__
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "utils/types.hpp"
+#include "circuit/quantumcircuit.hpp"
+#include "transpiler/target.hpp"
+
+namespace Qiskit {
+namespace transpiler {
+
+/// @class SchedulingMethod
+/// @brief Method of the scheduling stage.
+enum class SchedulingMethod {
+    NONE,
+    ASAP,
+    ALAP,
+};
+
+/// @class InstructionDurations
+/// @brief Durations of instructions on qubits in units of dt, taken from a target.
+/// @details Durations are rounded to units of dt, and durations of pulses
+///          are extended to the minimum length and a multiple of the
+///          granularity. If the target has no dt, dt is 1 ns. Instructions
+///          not in the target take no time.
+class InstructionDurations {
+protected:
+    // durations of an instruction keyed by qargs
+    struct QargsDurations {
+        std::unordered_map<std::uint64_t, uint_t> packed[3];        // 0, 1 or 2 qubits packed in 64 bits
+        std::map<std::vector<std::uint32_t>, uint_t> others;        // 3 or more qubits
+    };
+
+    double dt_ = 1e-9;
+    uint_t granularity_ = 1;
+    uint_t min_length_ = 1;
+    uint_t pulse_alignment_ = 1;
+    uint_t acquire_alignment_ = 1;
+    std::unordered_map<std::string, QargsDurations> durations_;   // name -> qargs -> duration
+public:
+    /// @brief Create empty durations
+    InstructionDurations() {}
+
+    /// @brief Create durations of instructions in a target
+    /// @param target a target with instruction properties
+    InstructionDurations(const Target &target)
+    {
+        if (target.dt() > 0.0) {
+            dt_ = target.dt();
+        }
+        granularity_ = std::max<uint_t>(target.granularity(), 1);
+        min_length_ = target.min_length();
+        pulse_alignment_ = std::max<uint_t>(target.pulse_alignment(), 1);
+        acquire_alignment_ = std::max<uint_t>(target.acquire_alignment(), 1);
+        for (auto &prop : target.properties()) {
+            auto &durations = durations_[prop.first];
+            for (auto &inst : prop.second) {
+                uint_t d = to_dt(inst.duration);
+                if (inst.qargs.size() < 3) {
+                    durations.packed[inst.qargs.size()][pack_qargs(inst.qargs.data(), inst.qargs.size())] = d;
+                } else {
+                    durations.others[inst.qargs] = d;
+                }
+            }
+        }
+    }
+
+    /// @brief Return dt
+    /// @return dt in seconds
+    double dt(void) const
+    {
+        return dt_;
+    }
+
+    /// @brief Return alignment of start times of gates
+    /// @return alignment in units of dt
+    uint_t pulse_alignment(void) const
+    {
+        return pulse_alignment_;
+    }
+
+    /// @brief Return alignment of start times of measurements
+    /// @return alignment in units of dt
+    uint_t acquire_alignment(void) const
+    {
+        return acquire_alignment_;
+    }
+
+    /// @brief Return duration of an instruction
+    /// @param name name of the instruction
+    /// @param qubits qubits of the instruction
+    /// @param num_qubits number of qubits
+    /// @return duration in units of dt (0 if the instruction is not in the target)
+    uint_t duration(const std::string &name, const std::uint32_t *qubits, const uint_t num_qubits) const
+    {
+        auto inst = durations_.find(name);
+        if (inst == durations_.end()) {
+            return 0;
+        }
+        if (num_qubits < 3) {
+            auto &packed = inst->second.packed[num_qubits];
+            auto d = packed.find(pack_qargs(qubits, num_qubits));
+            return d == packed.end() ? 0 : d->second;
+        }
+        auto &others = inst->second.others;
+        auto d = others.find(std::vector<std::uint32_t>(qubits, qubits + num_qubits));
+        return d == others.end() ? 0 : d->second;
+    }
+
+    /// @brief Return duration of a delay
+    /// @details The duration is the parameter of the delay in units of dt,
+    ///          since the unit of a delay is not available from the C-API.
+    /// @param op a delay instruction
+    /// @return duration in units of dt (0 if the duration is not a number)
+    static uint_t delay_duration(const QkCircuitInstruction &op)
+    {
+        if (op.num_params == 0) {
+            return 0;
+        }
+        double value = qk_param_as_real(op.params[0]);
+        if (std::isnan(value)) {
+            std::cerr << " InstructionDurations : duration of delay is not bound" << std::endl;
+            return 0;
+        }
+        if (!(value > 0.0)) {
+            return 0;
+        }
+        return (uint_t)std::llround(value);
+    }
+
+    /// @brief Convert a duration in seconds to units of dt
+    /// @param seconds duration in seconds
+    /// @return duration in units of dt satisfying the timing constraints (0 for no duration)
+    uint_t to_dt(const double seconds) const
+    {
+        if (!(seconds > 0.0)) {
+            return 0;
+        }
+        uint_t d = (uint_t)std::llround(seconds / dt_);
+        if (d == 0) {
+            return 0;
+        }
+        d = std::max(d, min_length_);
+        return align_up(d, granularity_);
+    }
+
+    /// @brief Round up a time to a multiple of an alignment
+    static uint_t align_up(const uint_t time, const uint_t alignment)
+    {
+        return (time + alignment - 1) / alignment * alignment;
+    }
+protected:
+    // pack up to 2 qubits into a key
+    static std::uint64_t pack_qargs(const std::uint32_t *qubits, const uint_t num_qubits)
+    {
+        std::uint64_t key = 0;
+        for (uint_t i = 0; i < num_qubits; i++) {
+            key = (key << 32) | qubits[i];
+        }
+        return key;
+    }
+};
+
+/// @brief Schedule instructions of a circuit
+/// @details Instructions are placed in one pass over the instruction list
+///          (a topological order of the DAG), keeping the time reached on
+///          each qubit and clbit, so this takes linear time in the number of
+///          operands. Start times of gates are aligned to the pulse
+///          alignment and start times of measurements to the acquire
+///          alignment. Barriers take no time and synchronize their qubits.
+///          Delays take the duration of their parameter in units of dt.
+///          ASAP starts each instruction as early as possible. ALAP starts
+///          each instruction as late as possible, with the end of the
+///          circuit aligned to both alignments. Start times and the duration
+///          are set to the circuit (see QuantumCircuit::op_start_times).
+/// @param circ a circuit to be scheduled
+/// @param durations durations of instructions
+/// @param method ASAP or ALAP
+/// @return duration of the circuit in units of dt
+inline uint_t schedule(circuit::QuantumCircuit &circ, const InstructionDurations &durations, const SchedulingMethod method)
+{
+    // operands, durations and alignments read once
+    struct ScheduleOp {
+        uint_t bit_pos;         // position of operands in bits
+        uint_t num_bits;        // number of operands
+        uint_t length;          // duration in dt
+        uint_t alignment;       // alignment of the start time in dt
+    };
+    std::vector<ScheduleOp> ops;
+    ops.reserve(circ.num_instructions());
+    reg_t bits;                 // qubits, and clbits offset by the number of qubits
+    uint_t num_qubits = circ.num_qubits();
+    for (auto inst : circ.instructions()) {
+        const QkCircuitInstruction &op = inst.instruction();
+        ScheduleOp sop = {bits.size(), op.num_qubits + op.num_clbits, 0, 1};
+        if (inst.kind() == QkOperationKind_Delay) {
+            // delays are not pulses, so their start times are not aligned
+            sop.length = InstructionDurations::delay_duration(op);
+        } else if (inst.kind() != QkOperationKind_Barrier && sop.num_bits > 0) {
+            sop.length = durations.duration(op.name, op.qubits, op.num_qubits);
+            if (sop.length > 0) {
+                sop.alignment = (inst.kind() == QkOperationKind_Measure) ? durations.acquire_alignment() : durations.pulse_alignment();
+            }
+        }
+        bits.insert(bits.end(), op.qubits, op.qubits + op.num_qubits);
+        for (uint_t j = 0; j < op.num_clbits; j++) {
+            bits.push_back(num_qubits + op.clbits[j]);
+        }
+        ops.push_back(sop);
+    }
+
+    // time reached on each qubit and clbit
+    reg_t time(num_qubits + circ.num_clbits(), 0);
+    auto frontier = [&](const ScheduleOp &op) {
+        uint_t t = 0;
+        for (uint_t j = 0; j < op.num_bits; j++) {
+            t = std::max(t, time[bits[op.bit_pos + j]]);
+        }
+        return t;
+    };
+    auto advance = [&](const ScheduleOp &op, const uint_t t) {
+        for (uint_t j = 0; j < op.num_bits; j++) {
+            time[bits[op.bit_pos + j]] = t;
+        }
+    };
+
+    // instructions without operands (e.g. global phase) start at 0
+    reg_t start(ops.size(), 0);
+    uint_t total = 0;
+    if (method == SchedulingMethod::ALAP) {
+        // place instructions from the end, measuring times back from the end of the circuit
+        reg_t end(ops.size(), 0);
+        for (uint_t i = ops.size(); i-- > 0;) {
+            if (ops[i].num_bits == 0) {
+                continue;
+            }
+            end[i] = InstructionDurations::align_up(frontier(ops[i]) + ops[i].length, ops[i].alignment);
+            advance(ops[i], end[i]);
+            total = std::max(total, end[i]);
+        }
+
+        // align the end of the circuit, so start times are aligned
+        uint_t pulse = durations.pulse_alignment();
+        uint_t acquire = durations.acquire_alignment();
+        uint_t gcd = pulse;
+        for (uint_t r = acquire; r != 0;) {
+            uint_t t = gcd % r;
+            gcd = r;
+            r = t;
+        }
+        uint_t lcm = pulse / gcd * acquire;
+        total = InstructionDurations::align_up(total, lcm);
+
+        // remove idle time at the beginning keeping the alignment
+        uint_t first = total;
+        for (uint_t i = 0; i < ops.size(); i++) {
+            if (ops[i].num_bits > 0) {
+                start[i] = total - end[i];
+                first = std::min(first, start[i]);
+            }
+        }
+        uint_t shift = first / lcm * lcm;
+        for (uint_t i = 0; i < ops.size(); i++) {
+            if (ops[i].num_bits > 0) {
+                start[i] -= shift;
+            }
+        }
+        total -= shift;
+    } else {
+        for (uint_t i = 0; i < ops.size(); i++) {
+            if (ops[i].num_bits == 0) {
+                continue;
+            }
+            start[i] = InstructionDurations::align_up(frontier(ops[i]), ops[i].alignment);
+            uint_t t = start[i] + ops[i].length;
+            advance(ops[i], t);
+            total = std::max(total, t);
+        }
+    }
+
+    circ.set_op_start_times(start, total);
+    return total;
+}
+
+/// @brief Schedule instructions of a circuit with durations of a target
+/// @param circ a circuit to be scheduled
+/// @param target a target with instruction properties
+/// @param method ASAP or ALAP
+/// @return duration of the circuit in units of dt
+inline uint_t schedule(circuit::QuantumCircuit &circ, const Target &target, const SchedulingMethod method)
+{
+    return schedule(circ, InstructionDurations(target), method);
+}
+
+} // namespace transpiler
+} // namespace Qiskit
+
+#endif  // __qiskitcpp_transpiler_scheduling_hpp__
@@ -18,10 +18,15 @@
 #define __qiskitcpp_transpiler_target_def_hpp__
 
 #include "utils/types.hpp"
+#include "utils/fingerprint.hpp"
 #include "qiskit.h"
 
 #include "circuit/library/standard_gates/standard_gates.hpp"
 
+#include <algorithm>
+#include <set>
+#include <unordered_map>
+
 #include <nlohmann/json.hpp>
 using json = nlohmann::json;
 
@@ -49,13 +54,21 @@ protected:
     std::shared_ptr<QkTarget> target_ = nullptr;
     std::string backend_name_;
     std::vector<std::string> basis_gates_;
-    double dt_;
+    double dt_ = 0.0;
+    uint_t granularity_ = 1;        // timing constraints in units of dt
+    uint_t min_length_ = 1;
+    uint_t pulse_alignment_ = 1;
+    uint_t acquire_alignment_ = 1;
     uint_t max_experiments_;
     uint_t max_shots_;
     uint_t num_qubits_ = 0;
     bool is_set_ = false;
     std::vector<std::pair<uint32_t, uint32_t>> coupling_map_;
     std::unordered_map<std::string, std::vector<InstructionProperty>> properties_;
+    Fingerprint source_;            // hash of the json the target is made from
+    bool hashable_ = true;          // false if the content is only in the Rust target
+    mutable Fingerprint fingerprint_;   // hash of the content computed by fingerprint()
+    mutable bool has_fingerprint_ = false;
 public:
     /// @brief Create a new target
     Target() {}
@@ -67,6 +80,7 @@ public:
         num_qubits_ = qk_target_num_qubits(target);
         dt_ = qk_target_dt(target);
         is_set_ = true;
+        hashable_ = false;
     }
 
     /// @brief Create a new target
@@ -76,10 +90,20 @@ public:
         backend_name_ = other.backend_name_;
         basis_gates_ = other.basis_gates_;
         dt_ = other.dt_;
+        granularity_ = other.granularity_;
+        min_length_ = other.min_length_;
+        pulse_alignment_ = other.pulse_alignment_;
+        acquire_alignment_ = other.acquire_alignment_;
         max_experiments_ = other.max_experiments_;
         max_shots_ = other.max_shots_;
         num_qubits_ = other.num_qubits_;
         is_set_ = other.is_set_;
+        coupling_map_ = other.coupling_map_;
+        properties_ = other.properties_;
+        source_ = other.source_;
+        hashable_ = other.hashable_;
+        fingerprint_ = other.fingerprint_;
+        has_fingerprint_ = other.has_fingerprint_;
     }
 
     Target(const std::unordered_map<std::string, std::vector<InstructionProperty>>& props)
@@ -104,12 +128,11 @@ public:
         }
         num_qubits_ += 1;
 
-        auto name_map = Qiskit::circuit::get_standard_gate_name_mapping();
         for (auto &gate_name : basis_gates) {
             std::vector<InstructionProperty> props;
-            auto gate = name_map.find(gate_name);
-            if (gate != name_map.end()) {
-                if (gate->second.num_qubits() == 1) {
+            auto gate = Qiskit::circuit::find_standard_gate(gate_name);
+            if (gate != nullptr) {
+                if (gate->num_qubits == 1) {
                     for (uint_t i = 0; i < num_qubits_; i++) {
                         InstructionProperty p;
                         p.qargs = {(uint32_t)i};
@@ -117,7 +140,7 @@ public:
                         p.error = default_error;
                         props.push_back(p);
                     }
-                } else if (gate->second.num_qubits() == 2) {
+                } else if (gate->num_qubits == 2) {
                     for (auto &qargs : coupling_map) {
                         InstructionProperty p;
                         p.qargs = {qargs.first, qargs.second};
@@ -173,11 +196,179 @@ public:
         return basis_gates_;
     }
 
+    /// @brief time resolution of the backend
+    /// @return dt in seconds (0 if not given)
+    double dt(void) const
+    {
+        return dt_;
+    }
+
+    /// @brief granularity of pulse lengths
+    /// @return granularity in units of dt
+    uint_t granularity(void) const
+    {
+        return granularity_;
+    }
+
+    /// @brief minimum length of pulses
+    /// @return minimum length in units of dt
+    uint_t min_length(void) const
+    {
+        return min_length_;
+    }
+
+    /// @brief alignment of start times of gates
+    /// @return alignment in units of dt
+    uint_t pulse_alignment(void) const
+    {
+        return pulse_alignment_;
+    }
+
+    /// @brief alignment of start times of measurements
+    /// @return alignment in units of dt
+    uint_t acquire_alignment(void) const
+    {
+        return acquire_alignment_;
+    }
+
+    /// @brief properties of instructions
+    /// @details Available for targets made from json, instruction properties
+    ///          or basis gates and coupling map.
+    /// @return a map from instruction name to a list of properties
+    const std::unordered_map<std::string, std::vector<InstructionProperty>> &properties(void) const
+    {
+        return properties_;
+    }
+
+    /// @brief pairs of qubits connected by two-qubit instructions
+    /// @return a list of pairs of qubits
+    std::vector<std::pair<uint32_t, uint32_t>> coupling_map(void) const
+    {
+        if (!coupling_map_.empty()) {
+            return coupling_map_;
+        }
+        std::set<std::pair<uint32_t, uint32_t>> edges;
+        for (auto &prop : properties_) {
+            for (auto &inst : prop.second) {
+                if (inst.qargs.size() == 2) {
+                    edges.insert(std::make_pair(inst.qargs[0], inst.qargs[1]));
+                }
+            }
+        }
+        return std::vector<std::pair<uint32_t, uint32_t>>(edges.begin(), edges.end());
+    }
+
+    /// @brief Return a target restricted to a subset of qubits
+    /// @details Instructions acting only on the given qubits are kept, and
+    ///          qubits[i] is renamed to qubit i in the new target.
+    ///          Properties are available for targets made from json,
+    ///          instruction properties or basis gates and coupling map.
+    /// @param qubits a list of qubits of this target
+    /// @return a new target
+    Target subtarget(const std::vector<uint32_t> &qubits) const
+    {
+        std::unordered_map<uint32_t, uint32_t> index;
+        for (uint_t i = 0; i < qubits.size(); i++) {
+            index[qubits[i]] = (uint32_t)i;
+        }
+
+        std::unordered_map<std::string, std::vector<InstructionProperty>> props;
+        for (auto &prop : properties_) {
+            std::vector<InstructionProperty> sub_props;
+            for (auto &inst : prop.second) {
+                InstructionProperty p = inst;
+                bool inside = true;
+                for (auto &q : p.qargs) {
+                    auto it = index.find(q);
+                    if (it == index.end()) {
+                        inside = false;
+                        break;
+                    }
+                    q = it->second;
+                }
+                if (inside) {
+                    sub_props.push_back(p);
+                }
+            }
+            props[prop.first] = sub_props;
+        }
+
+        Target sub(props);
+        sub.backend_name_ = backend_name_;
+        sub.basis_gates_ = basis_gates_;
+        sub.dt_ = dt_;
+        sub.granularity_ = granularity_;
+        sub.min_length_ = min_length_;
+        sub.pulse_alignment_ = pulse_alignment_;
+        sub.acquire_alignment_ = acquire_alignment_;
+        return sub;
+    }
+
+    /// @brief Return if the content of the target can be hashed
+    /// @return false if the target is made from a Rust target, whose content is not visible to this class
+    bool is_hashable(void) const
+    {
+        return hashable_;
+    }
+
+    /// @brief Return a hash of the content of the target
+    /// @details The hash covers basis gates, coupling map and instruction
+    ///          properties, timing constraints and the json the target is
+    ///          made from.
+    ///          Instructions are hashed in the order of names. The number of
+    ///          qubits is not hashed, because it is derived from the others
+    ///          when the Rust target is built.
+    ///          The hash is kept until the target is modified. It is not
+    ///          thread safe to compute it, so call this before the target is
+    ///          shared by threads (e.g. transpiling a list of circuits).
+    /// @return 128-bit fingerprint
+    Fingerprint fingerprint(void) const
+    {
+        if (has_fingerprint_) {
+            return fingerprint_;
+        }
+        Fingerprint fp = source_;
+        fp.add_double(dt_);
+        fp.add(granularity_);
+        fp.add(min_length_);
+        fp.add(pulse_alignment_);
+        fp.add(acquire_alignment_);
+        fp.add(basis_gates_.size());
+        for (auto &gate : basis_gates_) {
+            fp.add_string(gate.c_str());
+        }
+        fp.add(coupling_map_.size());
+        for (auto &edge : coupling_map_) {
+            fp.add(((std::uint64_t)edge.first << 32) | edge.second);
+        }
+        std::vector<std::string> names;
+        names.reserve(properties_.size());
+        for (auto &prop : properties_) {
+            names.push_back(prop.first);
+        }
+        std::sort(names.begin(), names.end());
+        fp.add(names.size());
+        for (auto &name : names) {
+            fp.add_string(name.c_str());
+            auto &props = properties_.at(name);
+            fp.add(props.size());
+            for (auto &p : props) {
+                fp.add_array(p.qargs.data(), p.qargs.size());
+                fp.add_double(p.duration);
+                fp.add_double(p.error);
+            }
+        }
+        fingerprint_ = fp;
+        has_fingerprint_ = true;
+        return fp;
+    }
+
     /// @brief make target from json
     /// @param input json target obtained from IQP
     /// @return true if target is successfully made
     bool from_json(nlohmann::ordered_json &input)
     {
+        has_fingerprint_ = false;
         if (!input.contains("configuration")) {
             std::cerr << " Target Error : No configuration section found" << std::endl;
             return false;
@@ -195,6 +386,9 @@ public:
         }
         num_qubits_ = backend_configuration["n_qubits"];
 
+        source_ = Fingerprint();
+        source_.add_string(input.dump().c_str());
+
         if (target_) {
             target_.reset();
         }
@@ -214,14 +408,17 @@ public:
         }
         if (backend_configuration.contains("timing_constraints")) {
             auto timing_constraints = backend_configuration["timing_constraints"];
-            qk_target_set_granularity(target_.get(), timing_constraints["granularity"]);
-            qk_target_set_min_length(target_.get(), timing_constraints["min_length"]);
-            qk_target_set_pulse_alignment(target_.get(), timing_constraints["pulse_alignment"]);
-            qk_target_set_acquire_alignment(target_.get(), timing_constraints["acquire_alignment"]);
+            granularity_ = timing_constraints["granularity"];
+            min_length_ = timing_constraints["min_length"];
+            pulse_alignment_ = timing_constraints["pulse_alignment"];
+            acquire_alignment_ = timing_constraints["acquire_alignment"];
+            qk_target_set_granularity(target_.get(), granularity_);
+            qk_target_set_min_length(target_.get(), min_length_);
+            qk_target_set_pulse_alignment(target_.get(), pulse_alignment_);
+            qk_target_set_acquire_alignment(target_.get(), acquire_alignment_);
         }
 
         // get basis gates and make property entries
-        auto name_map = Qiskit::circuit::get_standard_gate_name_mapping();
         for (auto &gate : backend_configuration["basis_gates"]) {
             basis_gates_.push_back(gate);
         }
@@ -249,20 +446,27 @@ public:
             QkTargetEntry *target_entry = nullptr;
             auto entry = property_map.find(gate);
             if (entry == property_map.end()) {
-                auto inst = name_map.find(gate);
-                if (inst == name_map.end()) {
+                auto inst = Qiskit::circuit::find_standard_gate(gate);
+                if (inst == nullptr) {
                     if (gate == "reset") {
                         target_entry = qk_target_entry_new_reset();
                         property_map[gate] = target_entry;
                     }
                 } else {
-                    target_entry = qk_target_entry_new(inst->second.gate_map());
+                    target_entry = qk_target_entry_new(inst->gate);
                     property_map[gate] = target_entry;
                 }
             } else {
                 target_entry = entry->second;
             }
             if (target_entry) {
+                // keep properties to make sub-targets
+                InstructionProperty p;
+                p.qargs = qubits;
+                p.duration = duration;
+                p.error = error;
+                properties_[gate].push_back(p);
+
                 QkExitCode ret = qk_target_entry_add_property(target_entry, qubits.data(), (uint32_t)qubits.size(), duration, error);
                 if (ret != QkExitCode_Success) {
                     std::cerr << " target qk_target_entry_add_property error (" << ret << ") : " << gate << " [";
@@ -295,6 +499,11 @@ public:
                     duration = 1e-9 * (double)param["value"];
                 }
             }
+            InstructionProperty p;
+            p.qargs = {qubit};
+            p.duration = duration;
+            p.error = error;
+            properties_["measure"].push_back(p);
             qk_target_entry_add_property(measure, &qubit, 1, duration, error);
         }
         qk_target_add_instruction(target_.get(), measure);
@@ -308,6 +517,7 @@ public:
     /// @param properties properties of the instruction
     void add_instruction(const circuit::Instruction& instruction, const std::vector<InstructionProperty>& properties)
     {
+        has_fingerprint_ = false;
         auto prop = properties_.find(instruction.name());
         if (prop == properties_.end()) {
             properties_[instruction.name()] = properties;
@@ -343,7 +553,6 @@ protected:
         target_ = std::shared_ptr<QkTarget>(t, qk_target_free);
 
         // add properties
-        auto name_map = Qiskit::circuit::get_standard_gate_name_mapping();
         for (auto &prop : properties_) {
             QkTargetEntry *target_entry = nullptr;
             if (prop.first == "reset") {
@@ -351,9 +560,9 @@ protected:
             } else if (prop.first == "rzz") {
                 std::cerr << " Target: rzz gate is not supported until Qiskit C-API will support it." << std::endl;
             } else {
-                auto gate = name_map.find(prop.first);
-                if (gate != name_map.end()) {
-                    target_entry = qk_target_entry_new(gate->second.gate_map());
+                auto gate = Qiskit::circuit::find_standard_gate(prop.first);
+                if (gate != nullptr) {
+                    target_entry = qk_target_entry_new(gate->gate);
                 }
             }
 
@@ -376,11 +585,25 @@ protected:
         }
 
         // add measure properties
+        std::unordered_map<uint32_t, const InstructionProperty *> measure_props;
+        auto measure_prop = properties_.find("measure");
+        if (measure_prop != properties_.end()) {
+            for (auto &inst : measure_prop->second) {
+                if (inst.qargs.size() == 1) {
+                    measure_props[inst.qargs[0]] = &inst;
+                }
+            }
+        }
         QkTargetEntry *measure = qk_target_entry_new_measure();
         uint32_t qubit = 0;
         for (uint32_t qubit = 0; qubit < num_qubits_; qubit++) {
             double duration = 0.0;
             double error = 0.0;
+            auto it = measure_props.find(qubit);
+            if (it != measure_props.end()) {
+                duration = it->second->duration;
+                error = it->second->error;
+            }
             qk_target_entry_add_property(measure, &qubit, 1, duration, error);
         }
         qk_target_add_instruction(target_.get(), measure);
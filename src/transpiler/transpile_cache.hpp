@@ -0,0 +1,374 @@
+/*
+# This code is part of Qiskit.
+#
+# (C) Copyright IBM 2026.
+#
+# This code is licensed under the Apache License, Version 2.0. You may
+# obtain a copy of this license in the LICENSE.txt file in the root directory
+# of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# Any modifications or derivative works of this code must retain this
+# copyright notice, and modified files need to carry a notice indicating
+# that they have been altered from the originals.
+*/
+
+// cache of transpiled circuits
+
+#ifndef __qiskitcpp_transpiler_transpile_cache_hpp__
+#define __qiskitcpp_transpiler_transpile_cache_hpp__
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <list>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "utils/types.hpp"
+#include "utils/fingerprint.hpp"
+#include "circuit/quantumcircuit.hpp"
+#include "circuit/barrier.hpp"
+#include "circuit/measure.hpp"
+#include "circuit/reset.hpp"
+#include "transpiler/target.hpp"
+
+namespace Qiskit {
+namespace transpiler {
+
+/// @class TranspileCache
+/// @brief Cache of transpiled circuits keyed by the content of the inputs.
+/// @details The key is a hash of the circuit structure, the target content,
+///          the optimization level, the approximation degree, the seed and
+///          the stages. Entries are kept in memory in LRU order, and also
+///          written to a directory if it is given, so they can be read by
+///          later processes. A transpiled circuit shares the Rust circuit
+///          of the entry until it is modified.
+///          Circuits with unitaries or symbolic parameters are only kept in
+///          memory, since matrices can not be read and symbols read from a
+///          file would be new symbols sharing only the names. The global
+///          phase set by the transpiler can not be read through the C-API,
+///          so a circuit read from the directory has the global phase of
+///          its instructions only; this does not change sampled results,
+///          but the circuit can differ from an entry in memory. Callers do not use the cache for circuits or targets
+///          which are not hashable (see QuantumCircuit::is_hashable).
+///          This class is thread safe.
+class TranspileCache {
+protected:
+    struct Entry {
+        std::shared_ptr<rust_circuit> circuit;
+        std::vector<uint32_t> layout;
+    };
+    using LRUList = std::list<std::pair<Fingerprint, Entry>>;
+
+    uint_t capacity_;
+    std::string directory_;
+    LRUList entries_;                                       // most recently used first
+    std::unordered_map<Fingerprint, LRUList::iterator> index_;
+    uint_t hits_ = 0;
+    uint_t disk_hits_ = 0;
+    uint_t misses_ = 0;
+    std::mutex mutex_;
+
+    static const int format_version = 1;
+public:
+    /// @brief Create a new cache
+    /// @param capacity the maximum number of entries kept in memory
+    /// @param directory an existing directory to store entries (empty to keep entries only in memory)
+    TranspileCache(const uint_t capacity = 256, const std::string &directory = std::string())
+        : capacity_(capacity), directory_(directory)
+    {
+    }
+
+    TranspileCache(const TranspileCache &) = delete;
+    TranspileCache &operator=(const TranspileCache &) = delete;
+
+    /// @brief Return the key of a transpilation
+    /// @details Transpilation with a negative seed is not deterministic;
+    ///          the first result is returned for later calls.
+    /// @param circ an input circuit
+    /// @param target a target
+    /// @param optimization_level level of optimization
+    /// @param approximation_degree the approximation degree
+    /// @param seed_transpiler the seed for the transpiler
+    /// @param stages names of stages run by a pass manager (empty for all stages)
+    /// @return 128-bit key
+    static Fingerprint key(const circuit::QuantumCircuit &circ, const Target &target, const int optimization_level, const double approximation_degree, const int seed_transpiler, const std::vector<std::string> &stages = std::vector<std::string>())
+    {
+        Fingerprint fp;
+        Fingerprint c = circ.fingerprint();
+        fp.add(c.high());
+        fp.add(c.low());
+        Fingerprint t = target.fingerprint();
+        fp.add(t.high());
+        fp.add(t.low());
+        fp.add((std::uint64_t)optimization_level);
+        fp.add_double(approximation_degree);
+        fp.add((std::uint64_t)(std::int64_t)seed_transpiler);
+        fp.add(stages.size());
+        for (auto &stage : stages) {
+            fp.add_string(stage.c_str());
+        }
+        return fp;
+    }
+
+    /// @brief Set a transpiled circuit found in the cache
+    /// @details The Rust circuit and the layout of the entry are set to out,
+    ///          whose registers are kept.
+    /// @param key a key made by key()
+    /// @param out a copy of the input circuit, replaced by the transpiled circuit on hit
+    /// @return true if the entry is found
+    bool load(const Fingerprint &key, circuit::QuantumCircuit &out)
+    {
+        Entry entry;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = index_.find(key);
+            if (it != index_.end()) {
+                entries_.splice(entries_.begin(), entries_, it->second);
+                entry = it->second->second;
+                hits_++;
+            }
+        }
+        if (!entry.circuit && !directory_.empty() && read_file(key, entry)) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            insert(key, entry);
+            disk_hits_++;
+            hits_++;
+        }
+        if (!entry.circuit) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            misses_++;
+            return false;
+        }
+        out.set_qiskit_circuit(entry.circuit, entry.layout);
+        return true;
+    }
+
+    /// @brief Store a transpiled circuit
+    /// @param key a key made by key()
+    /// @param transpiled the transpiled circuit
+    void store(const Fingerprint &key, circuit::QuantumCircuit &transpiled)
+    {
+        Entry entry;
+        entry.circuit = transpiled.get_rust_circuit();
+        const reg_t &map = transpiled.get_qubit_map();
+        entry.layout.assign(map.begin(), map.end());
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            insert(key, entry);
+        }
+        if (!directory_.empty()) {
+            write_file(key, transpiled, entry.layout);
+        }
+    }
+
+    /// @brief Return the number of hits (in memory or on disk)
+    uint_t hits(void)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return hits_;
+    }
+
+    /// @brief Return the number of hits read from the directory
+    uint_t disk_hits(void)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return disk_hits_;
+    }
+
+    /// @brief Return the number of misses
+    uint_t misses(void)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return misses_;
+    }
+
+    /// @brief Return the number of entries in memory
+    uint_t size(void)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return entries_.size();
+    }
+
+    /// @brief Return the maximum number of entries in memory
+    uint_t capacity(void) const
+    {
+        return capacity_;
+    }
+
+    /// @brief Return the directory to store entries
+    const std::string &directory(void) const
+    {
+        return directory_;
+    }
+
+    /// @brief Remove all entries in memory and reset counters
+    /// @details Files in the directory are not removed.
+    void clear(void)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_.clear();
+        index_.clear();
+        hits_ = 0;
+        disk_hits_ = 0;
+        misses_ = 0;
+    }
+
+    /// @brief Return a cache shared in the process
+    /// @return reference to an in-memory cache
+    static TranspileCache &shared(void)
+    {
+        static TranspileCache cache;
+        return cache;
+    }
+protected:
+    void insert(const Fingerprint &key, const Entry &entry)
+    {
+        if (capacity_ == 0) {
+            return;
+        }
+        auto it = index_.find(key);
+        if (it != index_.end()) {
+            it->second->second = entry;
+            entries_.splice(entries_.begin(), entries_, it->second);
+            return;
+        }
+        entries_.emplace_front(key, entry);
+        index_[key] = entries_.begin();
+        if (entries_.size() > capacity_) {
+            index_.erase(entries_.back().first);
+            entries_.pop_back();
+        }
+    }
+
+    std::string file_name(const Fingerprint &key) const
+    {
+        std::string name = directory_;
+        if (name.back() != '/' && name.back() != '\\') {
+            name += '/';
+        }
+        return name + key.to_string() + ".json";
+    }
+
+    // write the transpiled circuit as a list of instructions
+    void write_file(const Fingerprint &key, circuit::QuantumCircuit &transpiled, const std::vector<uint32_t> &layout)
+    {
+        nlohmann::ordered_json output;
+        output["version"] = (int)format_version;
+        output["key"] = key.to_string();
+        output["num_qubits"] = transpiled.num_qubits();
+        output["num_clbits"] = transpiled.num_clbits();
+        output["final_layout"] = layout;
+        nlohmann::ordered_json instructions = nlohmann::ordered_json::array();
+        uint_t nops = transpiled.num_instructions();
+        for (uint_t i = 0; i < nops; i++) {
+            circuit::CircuitInstruction inst = transpiled[i];
+            const circuit::Instruction &op = inst.instruction();
+            if (op.name().empty()) {
+                return;     // not serializable (e.g. unitary)
+            }
+            nlohmann::ordered_json params = nlohmann::ordered_json::array();
+            for (auto &p : op.params()) {
+                double value = p.as_real();
+                if (std::isnan(value)) {
+                    return;     // symbols are not serialized
+                }
+                params.push_back(value);
+            }
+            nlohmann::ordered_json item;
+            item["name"] = op.name();
+            item["qubits"] = inst.qubits();
+            if (inst.clbits().size() > 0) {
+                item["clbits"] = inst.clbits();
+            }
+            if (params.size() > 0) {
+                item["params"] = params;
+            }
+            instructions.push_back(item);
+        }
+        output["instructions"] = instructions;
+
+        // write to a temporary file and rename, so readers see a complete file
+        std::string name = file_name(key);
+        std::stringstream tmp_name;
+        tmp_name << name << ".tmp" << std::this_thread::get_id() << "_" << std::chrono::steady_clock::now().time_since_epoch().count();
+        std::string tmp = tmp_name.str();
+        {
+            std::ofstream file(tmp);
+            if (!file) {
+                std::cerr << " TranspileCache Error : failed to write " << tmp << std::endl;
+                return;
+            }
+            file << output.dump();
+        }
+        if (std::rename(tmp.c_str(), name.c_str()) != 0) {
+            std::remove(tmp.c_str());
+        }
+    }
+
+    bool read_file(const Fingerprint &key, Entry &entry)
+    {
+        std::ifstream file(file_name(key));
+        if (!file) {
+            return false;
+        }
+        nlohmann::ordered_json input = nlohmann::ordered_json::parse(file, nullptr, false);
+        if (input.is_discarded() || !input.contains("version") || input["version"] != (int)format_version ||
+            !input.contains("key") || input["key"] != key.to_string()) {
+            std::cerr << " TranspileCache Error : " << file_name(key) << " is not a valid entry" << std::endl;
+            return false;
+        }
+
+        circuit::QuantumCircuit circ((uint_t)input["num_qubits"], (uint_t)input["num_clbits"]);
+        for (auto &item : input["instructions"]) {
+            std::string name = item["name"];
+            reg_t qubits = item["qubits"];
+            reg_t clbits;
+            if (item.contains("clbits")) {
+                clbits = item["clbits"].get<reg_t>();
+            }
+            circuit::Instruction op;
+            if (name == "measure") {
+                op = circuit::Measure();
+            } else if (name == "reset") {
+                op = circuit::Reset();
+            } else if (name == "barrier") {
+                op = circuit::Barrier();
+            } else {
+                const circuit::StandardGateInfo *gate = circuit::find_standard_gate(name);
+                if (gate == nullptr) {
+                    std::cerr << " TranspileCache Error : unknown instruction " << name << " in " << file_name(key) << std::endl;
+                    return false;
+                }
+                op = circuit::standard_gate_instruction(*gate);
+                if (item.contains("params")) {
+                    std::vector<circuit::Parameter> params;
+                    for (auto &p : item["params"]) {
+                        if (!p.is_number()) {
+                            std::cerr << " TranspileCache Error : parameter of " << name << " is not a number in " << file_name(key) << std::endl;
+                            return false;
+                        }
+                        params.push_back(circuit::Parameter(p.get<double>()));
+                    }
+                    op.set_params(params);
+                }
+            }
+            circ.append(circuit::CircuitInstruction(op, qubits, clbits));
+        }
+        entry.circuit = circ.get_rust_circuit();
+        entry.layout = input["final_layout"].get<std::vector<uint32_t>>();
+        return true;
+    }
+};
+
+} // namespace transpiler
+} // namespace Qiskit
+
+#endif  // __qiskitcpp_transpiler_transpile_cache_hpp__
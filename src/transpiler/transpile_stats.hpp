@@ -0,0 +1,138 @@
+/*
+# This code is part of Qiskit.
+#
+# (C) Copyright IBM 2026.
+#
+# This code is licensed under the Apache License, Version 2.0. You may
+# obtain a copy of this license in the LICENSE.txt file in the root directory
+# of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# Any modifications or derivative works of this code must retain this
+# copyright notice, and modified files need to carry a notice indicating
+# that they have been altered from the originals.
+*/
+
+// timing and statistics of transpiler stages
+
+#ifndef __qiskitcpp_transpiler_transpile_stats_hpp__
+#define __qiskitcpp_transpiler_transpile_stats_hpp__
+
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "utils/types.hpp"
+#include "circuit/circuit_metrics.hpp"
+
+namespace Qiskit {
+namespace transpiler {
+
+/// @struct StageStats
+/// @brief Statistics of a transpiler stage
+struct StageStats {
+    std::string name;           // name of the stage
+    double time = 0.0;          // wall time in seconds
+    uint_t size_before = 0;     // number of operations before the stage
+    uint_t size_after = 0;      // number of operations after the stage
+    uint_t num_2q_gates = 0;    // number of multi-qubit operations after the stage
+    uint_t depth = 0;           // depth after the stage
+    uint_t num_swaps = 0;       // number of swap gates inserted by the stage
+};
+
+/// @class TranspileStats
+/// @brief Wall time and circuit metrics recorded for each stage of a transpilation.
+/// @details Operations counted are the ones adding depth (see CircuitMetrics),
+///          so barriers and global phase are not counted.
+class TranspileStats {
+protected:
+    std::vector<StageStats> stages_;
+public:
+    /// @brief Create empty statistics
+    TranspileStats() {}
+
+    /// @brief Add statistics of a stage
+    /// @param name name of the stage
+    /// @param time wall time of the stage in seconds
+    /// @param before metrics of the circuit before the stage
+    /// @param after metrics of the circuit after the stage
+    void add(const std::string &name, const double time, const circuit::CircuitMetrics &before, const circuit::CircuitMetrics &after)
+    {
+        StageStats stage;
+        stage.name = name;
+        stage.time = time;
+        stage.size_before = before.size();
+        stage.size_after = after.size();
+        stage.num_2q_gates = after.num_nonlocal_gates();
+        stage.depth = after.depth();
+        uint_t swaps_before = before.count_ops(QkGate_Swap);
+        uint_t swaps_after = after.count_ops(QkGate_Swap);
+        if (swaps_after > swaps_before) {
+            stage.num_swaps = swaps_after - swaps_before;
+        }
+        stages_.push_back(stage);
+    }
+
+    /// @brief Return statistics of all stages
+    /// @return a list of statistics in the order of stages run
+    const std::vector<StageStats> &stages(void) const
+    {
+        return stages_;
+    }
+
+    /// @brief Return statistics of a stage
+    /// @param name name of the stage
+    /// @return pointer to the statistics (nullptr if the stage is not run)
+    const StageStats *stage(const std::string &name) const
+    {
+        for (auto &stage : stages_) {
+            if (stage.name == name) {
+                return &stage;
+            }
+        }
+        return nullptr;
+    }
+
+    /// @brief Return the number of stages recorded
+    uint_t size(void) const
+    {
+        return stages_.size();
+    }
+
+    /// @brief Return wall time of all stages
+    /// @return the sum of wall time of stages in seconds
+    double total_time(void) const
+    {
+        double total = 0.0;
+        for (auto &stage : stages_) {
+            total += stage.time;
+        }
+        return total;
+    }
+
+    /// @brief Remove all statistics
+    void clear(void)
+    {
+        stages_.clear();
+    }
+
+    /// @brief Return a table of statistics
+    /// @return a string with a line for each stage
+    std::string to_string(void) const
+    {
+        std::stringstream ss;
+        ss << std::left << std::setw(14) << "stage" << std::right << std::setw(12) << "time [ms]" << std::setw(10) << "size in"
+           << std::setw(10) << "size out" << std::setw(8) << "2q" << std::setw(8) << "depth" << std::setw(8) << "swaps" << std::endl;
+        for (auto &stage : stages_) {
+            ss << std::left << std::setw(14) << stage.name << std::right << std::setw(12) << std::fixed << std::setprecision(3) << stage.time * 1000.0
+               << std::setw(10) << stage.size_before << std::setw(10) << stage.size_after << std::setw(8) << stage.num_2q_gates
+               << std::setw(8) << stage.depth << std::setw(8) << stage.num_swaps << std::endl;
+        }
+        return ss.str();
+    }
+};
+
+} // namespace transpiler
+} // namespace Qiskit
+
+#endif  // __qiskitcpp_transpiler_transpile_stats_hpp__
@@ -0,0 +1,171 @@
+/*
+# This code is part of Qiskit.
+#
+# (C) Copyright IBM 2026.
+#
+# This code is licensed under the Apache License, Version 2.0. You may
+# obtain a copy of this license in the LICENSE.txt file in the root directory
+# of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# Any modifications or derivative works of this code must retain this
+# copyright notice, and modified files need to carry a notice indicating
+# that they have been altered from the originals.
+*/
+
+// transpiled parameterized circuit bound after transpilation
+
+#ifndef __qiskitcpp_transpiler_transpiled_template_hpp__
+#define __qiskitcpp_transpiler_transpiled_template_hpp__
+
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "utils/types.hpp"
+#include "utils/thread_pool.hpp"
+#include "circuit/quantumcircuit.hpp"
+#include "circuit/parameter_table.hpp"
+
+namespace Qiskit {
+namespace transpiler {
+
+/// @class TranspiledTemplate
+/// @brief A parameterized circuit transpiled once and bound many times.
+/// @details Holds the transpiled circuit with unbound parameters and the
+///          mapping from parameters of the input circuit to the parameter
+///          slots of the transpiled circuit. Values are given in the order of
+///          parameters of the input circuit, and are bound to the transpiled
+///          circuit without running the transpiler again, so layout and
+///          routing are shared by all bindings. A parameter removed by the
+///          transpiler has no slot and its value is ignored.
+class TranspiledTemplate {
+protected:
+    circuit::QuantumCircuit circuit_;
+    std::vector<std::string> names_;        // parameters of the input circuit
+    std::vector<uint_t> columns_;           // index in names_ of each parameter of circuit_
+    bool valid_ = false;
+public:
+    /// @brief Create an empty template
+    TranspiledTemplate() {}
+
+    /// @brief Create a new template
+    /// @param names names of parameters of the input circuit in its parameter order
+    /// @param transpiled the transpiled circuit with unbound parameters
+    TranspiledTemplate(const std::vector<std::string> &names, const circuit::QuantumCircuit &transpiled)
+        : circuit_(transpiled), names_(names)
+    {
+        std::unordered_map<std::string, uint_t> index(names_.size() * 2);
+        for (uint_t i = 0; i < names_.size(); i++) {
+            index[names_[i]] = i;
+        }
+        for (auto &name : circuit_.parameter_names()) {
+            auto it = index.find(name);
+            if (it == index.end()) {
+                std::cerr << " TranspiledTemplate Error : parameter " << name << " is not in the input circuit" << std::endl;
+                columns_.clear();
+                return;
+            }
+            columns_.push_back(it->second);
+        }
+        valid_ = true;
+    }
+
+    /// @brief Return if the template can be bound
+    /// @return true if all parameters of the transpiled circuit are in the input circuit
+    bool is_valid(void) const
+    {
+        return valid_;
+    }
+
+    /// @brief Return the transpiled circuit with unbound parameters
+    /// @return reference to the transpiled circuit
+    circuit::QuantumCircuit &circuit(void)
+    {
+        return circuit_;
+    }
+
+    /// @brief Return names of parameters of the input circuit
+    /// @return a list of names in the order of values taken by bind
+    const std::vector<std::string> &parameter_names(void) const
+    {
+        return names_;
+    }
+
+    /// @brief Return the number of parameters of the input circuit
+    /// @return the number of values taken by bind
+    uint_t num_parameters(void) const
+    {
+        return names_.size();
+    }
+
+    /// @brief Return parameter slots of the transpiled circuit referencing a parameter
+    /// @param name name of a parameter of the input circuit
+    /// @return a list of references sorted by instruction (empty if the parameter is removed)
+    const std::vector<circuit::ParameterReference> &slots(const std::string &name) const
+    {
+        return circuit_.parameter_table().references(name);
+    }
+
+    /// @brief Return a transpiled circuit with values bound to all parameters
+    /// @param values a list of values in the order of parameter_names()
+    /// @return a bound circuit (an empty circuit if values do not match the parameters)
+    circuit::QuantumCircuit bind(const std::vector<double> &values) const
+    {
+        if (!valid_ || values.size() != names_.size()) {
+            std::cerr << " TranspiledTemplate::bind : " << values.size() << " values are given for " << names_.size() << " parameters" << std::endl;
+            return circuit::QuantumCircuit();
+        }
+        std::vector<double> selected(columns_.size());
+        for (uint_t i = 0; i < columns_.size(); i++) {
+            selected[i] = values[columns_[i]];
+        }
+        return circuit_.bind_parameters(selected);
+    }
+
+    /// @brief Bind sets of values and return transpiled circuits
+    /// @details Sets are bound in parallel by QuantumCircuit::bind_sweep.
+    /// @param values an array of num_sets x num_params values, each set in the order of parameter_names()
+    /// @param num_sets the number of sets of values
+    /// @param num_params the number of values in a set
+    /// @param pool a thread pool to bind sets
+    /// @return a list of bound circuits (empty if values do not match the parameters)
+    std::vector<circuit::QuantumCircuit> bind_sweep(const double *values, const uint_t num_sets, const uint_t num_params, ThreadPool &pool = ThreadPool::shared())
+    {
+        if (!valid_ || num_params != names_.size()) {
+            std::cerr << " TranspiledTemplate::bind_sweep : " << num_params << " values are given for " << names_.size() << " parameters" << std::endl;
+            return std::vector<circuit::QuantumCircuit>();
+        }
+        uint_t num_columns = columns_.size();
+        std::vector<double> selected(num_sets * num_columns);
+        for (uint_t set = 0; set < num_sets; set++) {
+            for (uint_t i = 0; i < num_columns; i++) {
+                selected[set * num_columns + i] = values[set * num_params + columns_[i]];
+            }
+        }
+        return circuit_.bind_sweep(selected.data(), num_sets, num_columns, pool);
+    }
+
+    /// @brief Bind sets of values and return transpiled circuits
+    /// @param values a list of sets of values, each in the order of parameter_names()
+    /// @param pool a thread pool to bind sets
+    /// @return a list of bound circuits (empty if values do not match the parameters)
+    std::vector<circuit::QuantumCircuit> bind_sweep(const std::vector<std::vector<double>> &values, ThreadPool &pool = ThreadPool::shared())
+    {
+        std::vector<double> flat;
+        flat.reserve(values.size() * names_.size());
+        for (auto &set : values) {
+            if (set.size() != names_.size()) {
+                std::cerr << " TranspiledTemplate::bind_sweep : " << set.size() << " values are given for " << names_.size() << " parameters" << std::endl;
+                return std::vector<circuit::QuantumCircuit>();
+            }
+            flat.insert(flat.end(), set.begin(), set.end());
+        }
+        return bind_sweep(flat.data(), values.size(), names_.size(), pool);
+    }
+};
+
+} // namespace transpiler
+} // namespace Qiskit
+
+#endif  // __qiskitcpp_transpiler_transpiled_template_hpp__
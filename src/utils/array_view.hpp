@@ -0,0 +1,95 @@
+/*
+# This code is part of Qiskit.
+#
+# (C) Copyright IBM 2026.
+#
+# This code is licensed under the Apache License, Version 2.0. You may
+# obtain a copy of this license in the LICENSE.txt file in the root directory
+# of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# Any modifications or derivative works of this code must retain this
+# copyright notice, and modified files need to carry a notice indicating
+# that they have been altered from the originals.
+*/
+
+// non-owning view of a contiguous array
+
+#ifndef __qiskitcpp_utils_array_view_hpp__
+#define __qiskitcpp_utils_array_view_hpp__
+
+#include <vector>
+
+#include "utils/types.hpp"
+
+namespace Qiskit {
+
+/// @class ArrayView
+/// @brief A non-owning, read-only view of a contiguous array
+template <typename T>
+class ArrayView {
+protected:
+    const T *data_;
+    uint_t size_;
+public:
+    /// @brief Create a new empty view
+    ArrayView() : data_(nullptr), size_(0) {}
+
+    /// @brief Create a new view
+    /// @param data pointer to the first element
+    /// @param size number of elements
+    ArrayView(const T *data, const uint_t size) : data_(data), size_(size) {}
+
+    /// @brief Create a new view of a vector
+    /// @param vec a vector to be viewed
+    ArrayView(const std::vector<T> &vec) : data_(vec.data()), size_(vec.size()) {}
+
+    /// @brief Return pointer to the first element
+    /// @return pointer to the first element
+    const T *data(void) const
+    {
+        return data_;
+    }
+
+    /// @brief Return number of elements
+    /// @return number of elements
+    uint_t size(void) const
+    {
+        return size_;
+    }
+
+    /// @brief check if the view is empty
+    /// @return true if the view has no element
+    bool empty(void) const
+    {
+        return size_ == 0;
+    }
+
+    /// @brief Return an element
+    /// @param i index of the element
+    /// @return the element at index i
+    const T &operator[](const uint_t i) const
+    {
+        return data_[i];
+    }
+
+    const T *begin(void) const
+    {
+        return data_;
+    }
+
+    const T *end(void) const
+    {
+        return data_ + size_;
+    }
+
+    /// @brief copy elements to a vector
+    /// @return a new vector
+    std::vector<T> to_vector(void) const
+    {
+        return std::vector<T>(data_, data_ + size_);
+    }
+};
+
+} // namespace Qiskit
+
+#endif  // __qiskitcpp_utils_array_view_hpp__
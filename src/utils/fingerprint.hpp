@@ -0,0 +1,191 @@
+/*
+# This code is part of Qiskit.
+#
+# (C) Copyright IBM 2026.
+#
+# This code is licensed under the Apache License, Version 2.0. You may
+# obtain a copy of this license in the LICENSE.txt file in the root directory
+# of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# Any modifications or derivative works of this code must retain this
+# copyright notice, and modified files need to carry a notice indicating
+# that they have been altered from the originals.
+*/
+
+// incremental 128-bit hash
+
+#ifndef __qiskitcpp_utils_fingerprint_hpp__
+#define __qiskitcpp_utils_fingerprint_hpp__
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+
+#include "utils/types.hpp"
+
+namespace Qiskit {
+
+/// @class Fingerprint
+/// @brief A 128-bit hash accumulated word by word.
+/// @details Words are absorbed with the body of MurmurHash3 (x64, 128-bit),
+///          and the finalization is applied when the digest is read, so
+///          both absorbing a word and reading the digest are O(1).
+///          This is not a cryptographic hash.
+class Fingerprint {
+protected:
+    std::uint64_t h1_ = 0x9368e53c2f6af274ULL;
+    std::uint64_t h2_ = 0x586dcd208f7cd3fdULL;
+    std::uint64_t length_ = 0;
+
+    static std::uint64_t rotl(const std::uint64_t x, const int r)
+    {
+        return (x << r) | (x >> (64 - r));
+    }
+
+    static std::uint64_t fmix(std::uint64_t k)
+    {
+        k ^= k >> 33;
+        k *= 0xff51afd7ed558ccdULL;
+        k ^= k >> 33;
+        k *= 0xc4ceb9fe1a85ec53ULL;
+        k ^= k >> 33;
+        return k;
+    }
+public:
+    /// @brief Create a new fingerprint of empty input
+    Fingerprint() {}
+
+    /// @brief Absorb a word
+    /// @param w a word
+    void add(const std::uint64_t w)
+    {
+        std::uint64_t k1 = w * 0x87c37b91114253d5ULL;
+        k1 = rotl(k1, 31) * 0x4cf5ad432745937fULL;
+        h1_ ^= k1;
+        h1_ = rotl(h1_, 27) + h2_;
+        h1_ = h1_ * 5 + 0x52dce729;
+
+        std::uint64_t k2 = w * 0x4cf5ad432745937fULL;
+        k2 = rotl(k2, 33) * 0x87c37b91114253d5ULL;
+        h2_ ^= k2;
+        h2_ = rotl(h2_, 31) + h1_;
+        h2_ = h2_ * 5 + 0x38495ab5;
+
+        length_++;
+    }
+
+    /// @brief Absorb a floating point value (0.0 and -0.0 are not distinguished)
+    /// @param v a value
+    void add_double(double v)
+    {
+        if (v == 0.0) {
+            v = 0.0;
+        }
+        std::uint64_t w;
+        std::memcpy(&w, &v, sizeof(w));
+        add(w);
+    }
+
+    /// @brief Absorb a string with its length
+    /// @param str null terminated string
+    void add_string(const char *str)
+    {
+        uint_t len = std::strlen(str);
+        add(len);
+        for (uint_t i = 0; i < len; i += 8) {
+            std::uint64_t w = 0;
+            std::memcpy(&w, str + i, len - i < 8 ? len - i : 8);
+            add(w);
+        }
+    }
+
+    /// @brief Absorb an array of 32-bit words with its length
+    /// @param data pointer to the array
+    /// @param size number of elements
+    void add_array(const std::uint32_t *data, const uint_t size)
+    {
+        add(size);
+        uint_t i = 0;
+        for (; i + 1 < size; i += 2) {
+            add(((std::uint64_t)data[i] << 32) | data[i + 1]);
+        }
+        if (i < size) {
+            add(data[i]);
+        }
+    }
+
+    /// @brief Return upper 64 bits of the digest
+    /// @return upper 64 bits
+    std::uint64_t high(void) const
+    {
+        std::uint64_t h1 = (h1_ ^ length_) + (h2_ ^ length_);
+        std::uint64_t h2 = (h2_ ^ length_) + h1;
+        h1 = fmix(h1);
+        h2 = fmix(h2);
+        return h1 + h2;
+    }
+
+    /// @brief Return lower 64 bits of the digest
+    /// @return lower 64 bits
+    std::uint64_t low(void) const
+    {
+        std::uint64_t h1 = (h1_ ^ length_) + (h2_ ^ length_);
+        std::uint64_t h2 = (h2_ ^ length_) + h1;
+        h1 = fmix(h1);
+        h2 = fmix(h2);
+        return h1 + 2 * h2;
+    }
+
+    /// @brief Return the digest as a hexadecimal string
+    /// @return 32 hexadecimal digits
+    std::string to_string(void) const
+    {
+        static const char digits[] = "0123456789abcdef";
+        std::string str(32, '0');
+        std::uint64_t hi = high();
+        std::uint64_t lo = low();
+        for (int i = 15; i >= 0; i--) {
+            str[i] = digits[hi & 15];
+            str[i + 16] = digits[lo & 15];
+            hi >>= 4;
+            lo >>= 4;
+        }
+        return str;
+    }
+
+    bool operator==(const Fingerprint &other) const
+    {
+        return h1_ == other.h1_ && h2_ == other.h2_ && length_ == other.length_;
+    }
+
+    bool operator!=(const Fingerprint &other) const
+    {
+        return !(*this == other);
+    }
+
+    bool operator<(const Fingerprint &other) const
+    {
+        if (h1_ != other.h1_)
+            return h1_ < other.h1_;
+        if (h2_ != other.h2_)
+            return h2_ < other.h2_;
+        return length_ < other.length_;
+    }
+};
+
+} // namespace Qiskit
+
+namespace std {
+
+template <>
+struct hash<Qiskit::Fingerprint> {
+    size_t operator()(const Qiskit::Fingerprint &fp) const
+    {
+        return (size_t)fp.low();
+    }
+};
+
+} // namespace std
+
+#endif  // __qiskitcpp_utils_fingerprint_hpp__
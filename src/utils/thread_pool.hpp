@@ -0,0 +1,180 @@
+/*
+# This code is part of Qiskit.
+#
+# (C) Copyright IBM 2026.
+#
+# This code is licensed under the Apache License, Version 2.0. You may
+# obtain a copy of this license in the LICENSE.txt file in the root directory
+# of this source tree or at http://www.apache.org/licenses/LICENSE-2.0.
+#
+# Any modifications or derivative works of this code must retain this
+# copyright notice, and modified files need to carry a notice indicating
+# that they have been altered from the originals.
+*/
+
+// pool of worker threads for parallel loops
+
+#ifndef __qiskitcpp_utils_thread_pool_hpp__
+#define __qiskitcpp_utils_thread_pool_hpp__
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "utils/types.hpp"
+
+namespace Qiskit {
+
+/// @class ThreadPool
+/// @brief A fixed number of worker threads running parallel loops.
+/// @details The calling thread also works on its own loop, so a loop can be
+///          called from a worker (nested loops) without deadlock; iterations
+///          not picked up by workers are run by the caller.
+class ThreadPool {
+protected:
+    struct Loop {
+        std::function<void(uint_t)> func;
+        uint_t size;
+        std::atomic<uint_t> next;
+        std::mutex mutex;
+        std::condition_variable finished;
+        uint_t active = 0;
+        bool closed = false;
+
+        Loop(const std::function<void(uint_t)> &f, const uint_t n) : func(f), size(n), next(0) {}
+
+        void run(void)
+        {
+            for (uint_t i = next++; i < size; i = next++) {
+                func(i);
+            }
+        }
+    };
+
+    std::vector<std::thread> workers_;
+    std::deque<std::shared_ptr<Loop>> queue_;
+    std::mutex mutex_;
+    std::condition_variable available_;
+    bool stop_ = false;
+public:
+    /// @brief Create a new pool
+    /// @param num_threads number of threads including the calling thread (0 for the number of hardware threads)
+    explicit ThreadPool(uint_t num_threads = 0)
+    {
+        if (num_threads == 0) {
+            num_threads = std::thread::hardware_concurrency();
+            if (num_threads == 0) {
+                num_threads = 1;
+            }
+        }
+        for (uint_t i = 1; i < num_threads; i++) {
+            workers_.push_back(std::thread([this]() { work(); }));
+        }
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        available_.notify_all();
+        for (auto &w : workers_) {
+            w.join();
+        }
+    }
+
+    /// @brief Return the number of threads including the calling thread
+    /// @return the number of threads
+    uint_t num_threads(void) const
+    {
+        return workers_.size() + 1;
+    }
+
+    /// @brief Return a pool shared in the process
+    /// @return reference to the pool with the number of hardware threads
+    static ThreadPool &shared(void)
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    /// @brief Call func(i) for i in [0, size) in parallel and wait for all calls
+    /// @param size number of iterations
+    /// @param func function called for each iteration
+    void parallel_for(const uint_t size, const std::function<void(uint_t)> &func)
+    {
+        if (size == 0) {
+            return;
+        }
+        if (size == 1 || workers_.empty()) {
+            for (uint_t i = 0; i < size; i++) {
+                func(i);
+            }
+            return;
+        }
+
+        auto loop = std::make_shared<Loop>(func, size);
+        uint_t num_tasks = std::min<uint_t>(size - 1, workers_.size());
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (uint_t i = 0; i < num_tasks; i++) {
+                queue_.push_back(loop);
+            }
+        }
+        if (num_tasks == 1) {
+            available_.notify_one();
+        } else {
+            available_.notify_all();
+        }
+
+        loop->run();
+
+        // workers starting after this point do nothing
+        std::unique_lock<std::mutex> lock(loop->mutex);
+        loop->closed = true;
+        loop->finished.wait(lock, [&loop]() { return loop->active == 0; });
+    }
+protected:
+    void work(void)
+    {
+        for (;;) {
+            std::shared_ptr<Loop> loop;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                available_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+                if (stop_ && queue_.empty()) {
+                    return;
+                }
+                loop = queue_.front();
+                queue_.pop_front();
+            }
+            {
+                std::lock_guard<std::mutex> lock(loop->mutex);
+                if (loop->closed) {
+                    continue;
+                }
+                loop->active++;
+            }
+            loop->run();
+            {
+                std::lock_guard<std::mutex> lock(loop->mutex);
+                loop->active--;
+            }
+            loop->finished.notify_all();
+        }
+    }
+};
+
+} // namespace Qiskit
+
+#endif  // __qiskitcpp_utils_thread_pool_hpp__
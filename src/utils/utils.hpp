@@ -70,11 +70,11 @@ inline bool _naive_parity(uint_t x) {
 
 
 #ifdef INTRINSIC_PARITY
-bool (*hamming_parity)(uint_t) = &_intrinsic_parity;
-uint_t (*popcount)(uint_t) = &_instrinsic_weight;
+static bool (*hamming_parity)(uint_t) = &_intrinsic_parity;
+static uint_t (*popcount)(uint_t) = &_instrinsic_weight;
 #else
-bool (*hamming_parity)(uint_t) = &_naive_parity;
-uint_t (*popcount)(uint_t) = &_naive_weight;
+static bool (*hamming_parity)(uint_t) = &_naive_parity;
+static uint_t (*popcount)(uint_t) = &_naive_weight;
 #endif
 
 
@@ -16,6 +16,7 @@
 #include "common.hpp"
 
 #include "circuit/quantumcircuit.hpp"
+#include "primitives/parameter_shift_gradient.hpp"
 using namespace Qiskit;
 using namespace Qiskit::circuit;
 
@@ -511,6 +512,624 @@ static int test_standard_gates(void) {
     return Ok;
 }
 
+static int test_standard_gate_table(void) {
+    for (uint_t i = 0; i < num_standard_gates; i++) {
+        const StandardGateInfo& info = standard_gate_info((QkGate)i);
+        if (info.num_qubits != qk_gate_num_qubits(info.gate) || info.num_params != qk_gate_num_params(info.gate)) {
+            std::cerr << "  standard gate table test : arity of " << info.name << " differs from C-API" << std::endl;
+            return EqualityError;
+        }
+        if (find_standard_gate(std::string(info.name)) != &info) {
+            std::cerr << "  standard gate table test : lookup of " << info.name << " failed" << std::endl;
+            return EqualityError;
+        }
+    }
+    if (find_standard_gate("measure") != nullptr || find_standard_gate("") != nullptr || find_standard_gate("cxx") != nullptr) {
+        std::cerr << "  standard gate table test : non-standard gate name is found" << std::endl;
+        return EqualityError;
+    }
+    return Ok;
+}
+
+static int test_instructions(void) {
+    auto circ = QuantumCircuit(3, 3);
+    circ.h(0);
+    circ.cx(0, 1);
+    circ.rz(0.5, 2);
+    circ.measure(2, 1);
+
+    uint_t count = 0;
+    for (auto inst : circ.instructions()) {
+        if (inst.index() != count) {
+            std::cerr << "  instructions test : index " << inst.index() << " != " << count << std::endl;
+            return EqualityError;
+        }
+        count++;
+    }
+    if (count != circ.num_instructions()) {
+        std::cerr << "  instructions test : number of instructions " << count << " != " << circ.num_instructions() << std::endl;
+        return EqualityError;
+    }
+
+    auto it = circ.instructions().begin();
+    ++it;
+    auto cx = *it;
+    if (!cx.is_standard_gate() || cx.gate() != QkGate_CX || cx.qubits().size() != 2 || cx.qubits()[0] != 0 || cx.qubits()[1] != 1 || !cx.params().empty()) {
+        std::cerr << "  instructions test : cx is not viewed correctly" << std::endl;
+        return EqualityError;
+    }
+    ++it;
+    auto rz = *it;
+    if (rz.gate() != QkGate_RZ || rz.params().size() != 1 || qk_param_as_real(rz.params()[0]) != 0.5 || rz.qubits()[0] != 2) {
+        std::cerr << "  instructions test : rz is not viewed correctly" << std::endl;
+        return EqualityError;
+    }
+    ++it;
+    auto meas = *it;
+    if (meas.kind() != QkOperationKind_Measure || meas.is_standard_gate() || meas.qubits()[0] != 2 || meas.clbits()[0] != 1) {
+        std::cerr << "  instructions test : measure is not viewed correctly" << std::endl;
+        return EqualityError;
+    }
+    return Ok;
+}
+
+static int test_copy_on_write(void) {
+    auto circ = QuantumCircuit(2, 2);
+    circ.h(0);
+    circ.measure(0, 0);
+
+    auto copied = circ;
+    auto cloned = circ.copy();
+    if (copied.get_rust_circuit().get() != circ.get_rust_circuit().get() || cloned.get_rust_circuit().get() != circ.get_rust_circuit().get()) {
+        std::cerr << "  copy on write test : copies do not share the circuit" << std::endl;
+        return EqualityError;
+    }
+
+    // modifying a copy must not change the source
+    copied.cx(0, 1);
+    copied.measure(1, 1);
+    if (circ.num_instructions() != 2 || copied.num_instructions() != 4 || cloned.num_instructions() != 2) {
+        std::cerr << "  copy on write test : modification of a copy changes the source" << std::endl;
+        return EqualityError;
+    }
+    if (circ.get_measure_map().size() != 1 || copied.get_measure_map().size() != 2) {
+        std::cerr << "  copy on write test : measure map is shared after modification" << std::endl;
+        return EqualityError;
+    }
+    if (cloned != circ) {
+        std::cerr << "  copy on write test : unmodified copy differs from the source" << std::endl;
+        return EqualityError;
+    }
+
+    // moving a circuit keeps the circuit
+    rust_circuit *ptr = circ.get_rust_circuit().get();
+    std::vector<QuantumCircuit> circuits;
+    circuits.push_back(std::move(circ));
+    for (uint_t i = 0; i < 16; i++) {
+        circuits.push_back(QuantumCircuit(2, 2));
+    }
+    if (circuits[0].get_rust_circuit().get() != ptr) {
+        std::cerr << "  copy on write test : circuit is cloned by move" << std::endl;
+        return EqualityError;
+    }
+    return Ok;
+}
+
+static int test_fingerprint(void) {
+    auto circ = QuantumCircuit(3, 3);
+    circ.h(0);
+    circ.rz(0.5, 1);
+    circ.cx(0, 2);
+    circ.measure(2, 2);
+
+    // the same instructions added in a different way
+    auto batch = QuantumCircuit(3, 3);
+    batch.append_batch({QkGate_H, QkGate_RZ, QkGate_CX}, {0, 1, 0, 2}, {0.5});
+    auto tail = QuantumCircuit(3, 3);
+    tail.measure(2, 2);
+    batch.compose(tail);
+    if (circ.fingerprint() != batch.fingerprint()) {
+        std::cerr << "  fingerprint test : " << circ.fingerprint().to_string() << " != " << batch.fingerprint().to_string() << std::endl;
+        return EqualityError;
+    }
+
+    // the hash of a transpiled circuit is computed from its instructions
+    auto reloaded = QuantumCircuit(3, 3);
+    reloaded.set_qiskit_circuit(std::shared_ptr<rust_circuit>(qk_circuit_copy(circ.get_rust_circuit().get()), qk_circuit_free), std::vector<uint32_t>({0, 1, 2}));
+    if (circ.fingerprint() != reloaded.fingerprint()) {
+        std::cerr << "  fingerprint test : reloaded circuit has different fingerprint" << std::endl;
+        return EqualityError;
+    }
+
+    auto copied = circ;
+    copied.rz(0.25, 1);
+    auto other = circ;
+    other.rz(0.125, 1);
+    auto phase = QuantumCircuit(3, 3, 0.5);
+    if (copied.fingerprint() == circ.fingerprint() || copied.fingerprint() == other.fingerprint() || phase.fingerprint() == QuantumCircuit(3, 3).fingerprint()) {
+        std::cerr << "  fingerprint test : different circuits have the same fingerprint" << std::endl;
+        return EqualityError;
+    }
+
+    // symbols are hashed by name
+    auto theta = Parameter("theta");
+    auto sym1 = QuantumCircuit(1, 0);
+    sym1.rx(theta, 0);
+    auto sym2 = QuantumCircuit(1, 0);
+    sym2.rx(theta, 0);
+    auto sym3 = QuantumCircuit(1, 0);
+    sym3.rx(Parameter("phi"), 0);
+    if (sym1.fingerprint() != sym2.fingerprint() || sym1.fingerprint() == sym3.fingerprint()) {
+        std::cerr << "  fingerprint test : symbols are not hashed correctly" << std::endl;
+        return EqualityError;
+    }
+    if (!(sym1 == sym2)) {
+        std::cerr << "  fingerprint test : circuits with the same fingerprint are not equal" << std::endl;
+        return EqualityError;
+    }
+
+    // matrices of unitaries are hashed, but not if they are set by a transpiler
+    auto unitary1 = QuantumCircuit(1, 0);
+    unitary1.unitary({0.0, 1.0, 1.0, 0.0}, {0});
+    auto unitary2 = QuantumCircuit(1, 0);
+    unitary2.unitary({1.0, 0.0, 0.0, -1.0}, {0});
+    if (unitary1.fingerprint() == unitary2.fingerprint() || !unitary1.is_hashable() || unitary1 == unitary2) {
+        std::cerr << "  fingerprint test : unitaries with different matrices are not distinguished" << std::endl;
+        return EqualityError;
+    }
+    auto reloaded_unitary = QuantumCircuit(1, 0);
+    reloaded_unitary.set_qiskit_circuit(std::shared_ptr<rust_circuit>(qk_circuit_copy(unitary1.get_rust_circuit().get()), qk_circuit_free), std::vector<uint32_t>({0}));
+    if (reloaded_unitary.is_hashable() || !reloaded.is_hashable()) {
+        std::cerr << "  fingerprint test : circuit with unitaries set by a transpiler is hashable" << std::endl;
+        return EqualityError;
+    }
+    return Ok;
+}
+
+static int test_equals(void) {
+    auto theta = Parameter("theta");
+    auto circ = QuantumCircuit(2, 2);
+    circ.h(0);
+    circ.rz(0.5, 1);
+    circ.rx(theta * 2.0, 0);
+    circ.cx(0, 1);
+    circ.measure(1, 1);
+
+    auto same = QuantumCircuit(2, 2);
+    same.h(0);
+    same.rz(0.25 + 0.25, 1);
+    same.rx(theta * 2.0, 0);
+    same.cx(0, 1);
+    same.measure(1, 1);
+    uint_t index = 100;
+    if (!circ.equals(same, &index) || index != 100) {
+        std::cerr << "  equals test : same circuits are not equal" << std::endl;
+        return EqualityError;
+    }
+
+    auto symbol = QuantumCircuit(2, 2);
+    symbol.h(0);
+    symbol.rz(0.5, 1);
+    symbol.rx(theta * 3.0, 0);
+    symbol.cx(0, 1);
+    symbol.measure(1, 1);
+    if (circ.equals(symbol, &index) || index != 2) {
+        std::cerr << "  equals test : difference of symbolic parameter is reported at " << index << std::endl;
+        return EqualityError;
+    }
+
+    auto qubits = circ;
+    qubits.cx(1, 0);
+    auto other = circ;
+    other.cx(0, 1);
+    if (qubits.equals(other, &index) || index != 5) {
+        std::cerr << "  equals test : difference of qubits is reported at " << index << std::endl;
+        return EqualityError;
+    }
+
+    auto longer = circ;
+    longer.h(1);
+    if (longer == circ || circ.equals(longer, &index) || index != 5) {
+        std::cerr << "  equals test : difference of length is reported at " << index << std::endl;
+        return EqualityError;
+    }
+    return Ok;
+}
+
+static int test_metrics(void) {
+    auto circ = QuantumCircuit(3, 3);
+    circ.h(0);
+    circ.cx(0, 1);
+    circ.rz(0.5, 2);
+    circ.measure(1, 1);
+    circ.barrier(reg_t({0, 1, 2}));
+    circ.cx(1, 2);
+    circ.h(0);
+
+    auto copied = circ;
+    copied.cx(0, 2);
+    if (circ.depth() != 4 || circ.depth_2q() != 2 || circ.num_nonlocal_gates() != 2 || copied.depth() != 5 || copied.depth_2q() != 3) {
+        std::cerr << "  metrics test : depth = " << circ.depth() << ", depth_2q = " << circ.depth_2q() << ", nonlocal = " << circ.num_nonlocal_gates()
+                  << ", depth of copy = " << copied.depth() << std::endl;
+        return EqualityError;
+    }
+
+    auto counts = circ.count_ops();
+    if (counts.size() != 5 || counts["h"] != 2 || counts["cx"] != 2 || counts["rz"] != 1 || counts["measure"] != 1 || counts["barrier"] != 1) {
+        std::cerr << "  metrics test : wrong count_ops" << std::endl;
+        return EqualityError;
+    }
+
+    // metrics of a transpiled circuit are computed from its instructions
+    auto reloaded = QuantumCircuit(3, 3);
+    reloaded.set_qiskit_circuit(std::shared_ptr<rust_circuit>(qk_circuit_copy(circ.get_rust_circuit().get()), qk_circuit_free), std::vector<uint32_t>({0, 1, 2}));
+    if (reloaded.depth() != 4 || reloaded.depth_2q() != 2 || reloaded.count_ops() != counts) {
+        std::cerr << "  metrics test : wrong metrics of reloaded circuit" << std::endl;
+        return EqualityError;
+    }
+
+    std::vector<reg_t> expected = {{0, 2}, {1}, {3, 6}, {5}};
+    if (circ.layers() != expected) {
+        std::cerr << "  metrics test : wrong layers" << std::endl;
+        return EqualityError;
+    }
+    return Ok;
+}
+
+static int test_reduce_to_lightcone(void) {
+    auto circ = QuantumCircuit(4, 2);
+    circ.h(0);
+    circ.cx(0, 1);
+    circ.h(2);          // qubit 2 is not measured
+    circ.x(3);          // qubit 3 is reset later
+    circ.reset(3);
+    circ.cx(3, 1);
+    circ.measure(0, 0); // overwritten by the last measurement
+    circ.measure(1, 1);
+    circ.h(0);          // after the measurement
+    circ.measure(1, 0);
+
+    auto expected = QuantumCircuit(4, 2);
+    expected.h(0);
+    expected.cx(0, 1);
+    expected.reset(3);
+    expected.cx(3, 1);
+    expected.measure(1, 1);
+    expected.measure(1, 0);
+
+    uint_t num_removed = circ.reduce_to_lightcone();
+    if (num_removed != 4 || circ != expected || circ.fingerprint() != expected.fingerprint()) {
+        std::cerr << "  reduce to lightcone test : " << num_removed << " instructions are removed" << std::endl;
+        circ.print();
+        return EqualityError;
+    }
+    if (circ.get_measure_map().size() != 2 || circ.depth() != expected.depth()) {
+        std::cerr << "  reduce to lightcone test : measure map or metrics are not updated" << std::endl;
+        return EqualityError;
+    }
+    if (circ.reduce_to_lightcone() != 0) {
+        std::cerr << "  reduce to lightcone test : reduced circuit is reduced again" << std::endl;
+        return EqualityError;
+    }
+
+    // a circuit without measurements is not modified
+    auto unmeasured = QuantumCircuit(2, 2, 0.5);
+    unmeasured.h(0);
+    unmeasured.cx(0, 1);
+    auto copied = unmeasured;
+    if (unmeasured.reduce_to_lightcone() != 0 || unmeasured != copied || unmeasured.num_instructions() != 3) {
+        std::cerr << "  reduce to lightcone test : gates of a circuit without measurements are removed" << std::endl;
+        return EqualityError;
+    }
+
+    // a circuit with an operation which can not be rebuilt is not modified
+    QkCircuit *rust = qk_circuit_new(2, 1);
+    std::uint32_t q1 = 1;
+    qk_circuit_gate(rust, QkGate_H, &q1, nullptr);
+    qk_circuit_delay(rust, 0, 100.0, QkDelayUnit_DT);
+    qk_circuit_measure(rust, 0, 0);
+    auto delayed = QuantumCircuit(2, 1);
+    delayed.set_qiskit_circuit(std::shared_ptr<rust_circuit>(rust, qk_circuit_free), std::vector<uint32_t>({0, 1}));
+    if (delayed.reduce_to_lightcone() != 0 || delayed.num_instructions() != 3) {
+        std::cerr << "  reduce to lightcone test : circuit with a delay is modified" << std::endl;
+        return EqualityError;
+    }
+    return Ok;
+}
+
+static int test_broadcast(void) {
+    auto qr1 = QuantumRegister(2, std::string("qa"));
+    auto qr2 = QuantumRegister(3, std::string("qb"));
+    auto cr = ClassicalRegister(3, std::string("c"));
+    auto circ = QuantumCircuit(std::vector<QuantumRegister>({qr1, qr2}), std::vector<ClassicalRegister>({cr}));
+    circ.reset(qr2);
+    circ.h(qr2);
+    circ.rz(0.5, reg_t({0, 4}));
+    circ.u(0.1, 0.2, 0.3, qr1);
+    circ.barrier(qr2);
+    circ.measure(qr2, cr);
+
+    auto expected = QuantumCircuit(std::vector<QuantumRegister>({qr1, qr2}), std::vector<ClassicalRegister>({cr}));
+    for (uint_t i = 2; i < 5; i++) {
+        expected.reset(i);
+    }
+    for (uint_t i = 2; i < 5; i++) {
+        expected.h(i);
+    }
+    expected.rz(0.5, 0);
+    expected.rz(0.5, 4);
+    expected.u(0.1, 0.2, 0.3, 0);
+    expected.u(0.1, 0.2, 0.3, 1);
+    expected.barrier(reg_t({2, 3, 4}));
+    for (uint_t i = 0; i < 3; i++) {
+        expected.measure(i + 2, i);
+    }
+    if (circ != expected || circ.get_measure_map() != expected.get_measure_map()) {
+        std::cerr << "  broadcast test : circuits differ" << std::endl;
+        return EqualityError;
+    }
+
+    // nothing is added if any operand is out of range
+    uint_t size = circ.num_instructions();
+    circ.x(reg_t({0, 5}));
+    circ.measure(reg_t({0, 1}), reg_t({0, 3}));
+    circ.measure(reg_t({0, 1}), reg_t({0}));
+    circ.reset(reg_t({7}));
+    if (circ.num_instructions() != size) {
+        std::cerr << "  broadcast test : invalid operands are added" << std::endl;
+        return EqualityError;
+    }
+    return Ok;
+}
+
+static int test_assign_parameters(void) {
+    auto theta = Parameter("theta");
+    auto phi = Parameter("phi");
+    auto circ = QuantumCircuit(2, 2);
+    circ.rx(theta, 0);
+    circ.cx(0, 1);
+    circ.rz(phi, 1);
+    circ.u(theta, phi, Parameter(0.5), 0);
+    circ.measure(0, 0);
+
+    std::vector<std::string> names = {"phi", "theta"};
+    if (circ.num_parameters() != 2 || circ.parameter_names() != names) {
+        std::cerr << "  assign_parameters test : wrong parameter names" << std::endl;
+        return EqualityError;
+    }
+
+    auto expected = QuantumCircuit(2, 2);
+    expected.rx(0.1, 0);
+    expected.cx(0, 1);
+    expected.rz(0.2, 1);
+    expected.u(0.1, 0.2, 0.5, 0);
+    expected.measure(0, 0);
+
+    auto bound = circ.bind_parameters(std::vector<double>({0.2, 0.1}));
+    if (bound != expected || bound.num_parameters() != 0 || circ.num_parameters() != 2) {
+        std::cerr << "  assign_parameters test : bound copy is wrong" << std::endl;
+        return EqualityError;
+    }
+    if (circ.bind_parameters(std::vector<double>({0.2})).num_qubits() != 0) {
+        std::cerr << "  assign_parameters test : wrong number of values is accepted" << std::endl;
+        return EqualityError;
+    }
+
+    // gates of numbers are added without QkParam
+    auto numeric = QuantumCircuit(2, 2);
+    numeric.rx(Parameter(0.05) * 2.0, 0);
+    numeric.cx(0, 1);
+    numeric.rz(Parameter(0.2), 1);
+    numeric.u(Parameter(0.1), Parameter(0.2), Parameter(0.5), 0);
+    numeric.measure(0, 0);
+    if (numeric != expected || numeric.num_parameters() != 0 || numeric.fingerprint() != expected.fingerprint()) {
+        std::cerr << "  assign_parameters test : gates of numeric parameters are wrong" << std::endl;
+        return EqualityError;
+    }
+
+    // partial binding by name, then in-place
+    circ.assign_parameter("theta", 0.1);
+    if (circ.parameter_names() != std::vector<std::string>({"phi"})) {
+        std::cerr << "  assign_parameters test : theta is not bound" << std::endl;
+        return EqualityError;
+    }
+    circ.assign_parameters(std::unordered_map<std::string, double>({{"phi", 0.2}}));
+    if (circ != expected || circ.fingerprint() != expected.fingerprint() || circ.get_measure_map() != expected.get_measure_map()) {
+        std::cerr << "  assign_parameters test : in-place binding is wrong" << std::endl;
+        return EqualityError;
+    }
+
+    // expressions are evaluated
+    auto expr = QuantumCircuit(1, 0);
+    expr.ry(theta * 2.0 + phi, 0);
+    expr.assign_parameters(std::vector<double>({0.5, 0.25}));
+    auto expected_expr = QuantumCircuit(1, 0);
+    expected_expr.ry(1.0, 0);
+    if (expr != expected_expr) {
+        std::cerr << "  assign_parameters test : expression is not evaluated" << std::endl;
+        return EqualityError;
+    }
+    return Ok;
+}
+
+static int test_parameter_table(void) {
+    auto theta = Parameter("theta");
+    auto phi = Parameter("phi");
+    auto circ = QuantumCircuit(2, 0);
+    circ.rx(theta, 0);
+    circ.ry(theta * 2.0 + phi, 1);
+    circ.cx(0, 1);
+    circ.u(Parameter(0.1), phi, theta, 1);
+
+    std::vector<ParameterReference> theta_refs = {{0, 0, true}, {1, 0, false}, {3, 2, true}};
+    std::vector<ParameterReference> phi_refs = {{1, 0, false}, {3, 1, true}};
+    const ParameterTable &table = circ.parameter_table();
+    if (table.size() != 2 || table.num_references() != 5 || table.references("theta") != theta_refs || table.references("phi") != phi_refs) {
+        std::cerr << "  parameter_table test : wrong references" << std::endl;
+        return EqualityError;
+    }
+
+    // the table of a copy is separated when either circuit is modified
+    auto copied = circ;
+    copied.rz(Parameter("lambda"), 0);
+    if (circ.parameter_table().size() != 2 || !copied.parameter_table().contains("lambda") ||
+        copied.parameter_table().references("lambda") != std::vector<ParameterReference>({{4, 0, true}})) {
+        std::cerr << "  parameter_table test : table is not copied on write" << std::endl;
+        return EqualityError;
+    }
+
+#ifdef QISKIT_CAPI_HAS_SUBS
+    // references are rebuilt after binding
+    circ.assign_parameter("theta", 0.5);
+    if (circ.parameter_table().size() != 1 || circ.parameter_table().references("phi") != phi_refs ||
+        circ.parameter_table().contains("theta")) {
+        std::cerr << "  parameter_table test : wrong references after binding" << std::endl;
+        return EqualityError;
+    }
+#endif
+    return Ok;
+}
+
+static int test_bind_sweep(void) {
+    auto theta = Parameter("theta");
+    auto phi = Parameter("phi");
+    auto circ = QuantumCircuit(2, 2);
+    circ.rx(theta, 0);
+    circ.cx(0, 1);
+    circ.rz(phi, 1);
+    circ.u(theta, phi, Parameter(0.5), 0);
+    circ.measure(0, 0);
+
+    // values of (phi, theta) for each set
+    std::vector<double> values = {0.2, 0.1, 0.4, 0.3, 0.6, 0.5};
+    ThreadPool pool(4);
+    auto circuits = circ.bind_sweep(values.data(), 3, 2, pool);
+    if (circuits.size() != 3) {
+        std::cerr << "  bind_sweep test : " << circuits.size() << " circuits are returned" << std::endl;
+        return EqualityError;
+    }
+    for (uint_t i = 0; i < 3; i++) {
+        auto expected = circ.bind_parameters(std::vector<double>(values.begin() + i * 2, values.begin() + i * 2 + 2));
+        if (circuits[i] != expected || circuits[i].num_parameters() != 0 || circuits[i].get_measure_map() != expected.get_measure_map()) {
+            std::cerr << "  bind_sweep test : circuit " << i << " is wrong" << std::endl;
+            return EqualityError;
+        }
+    }
+    if (circ.num_parameters() != 2) {
+        std::cerr << "  bind_sweep test : template circuit is modified" << std::endl;
+        return EqualityError;
+    }
+    if (circ.bind_sweep(values.data(), 2, 3, pool).size() != 0) {
+        std::cerr << "  bind_sweep test : wrong number of values is accepted" << std::endl;
+        return EqualityError;
+    }
+
+    // expressions are evaluated for each set
+    auto expr = QuantumCircuit(1, 0);
+    expr.ry(theta * 2.0 + phi, 0);
+    auto expr_circuits = expr.bind_sweep(values.data(), 3, 2, pool);
+    for (uint_t i = 0; i < expr_circuits.size(); i++) {
+        auto expected = QuantumCircuit(1, 0);
+        expected.ry(values[i * 2 + 1] * 2.0 + values[i * 2], 0);
+        if (expr_circuits[i] != expected) {
+            std::cerr << "  bind_sweep test : expression in circuit " << i << " is not evaluated" << std::endl;
+            return EqualityError;
+        }
+    }
+    if (expr_circuits.size() != 3) {
+        std::cerr << "  bind_sweep test : expressions are not bound" << std::endl;
+        return EqualityError;
+    }
+    return Ok;
+}
+
+static int test_parameter_shift(void) {
+    auto theta = Parameter("theta");
+    auto phi = Parameter("phi");
+    auto circ = QuantumCircuit(2, 2);
+    circ.rx(theta, 0);
+    circ.ry(phi, 1);
+    circ.rz(theta, 1);
+    circ.measure(0, 0);
+    circ.measure(1, 1);
+
+    // one shift for each occurrence of parameters
+    primitives::ParameterShiftGradient grad(circ);
+    if (!grad.is_valid() || grad.num_shifts() != 3 || grad.num_circuits() != 6 ||
+        grad.parameter_names() != std::vector<std::string>({"phi", "theta"})) {
+        std::cerr << "  parameter_shift test : wrong shifts" << std::endl;
+        return EqualityError;
+    }
+    std::vector<double> values = {0.2, 0.1};
+    auto pubs = grad.pubs(values, 100);
+    if (pubs.size() != 6) {
+        std::cerr << "  parameter_shift test : " << pubs.size() << " pubs are returned" << std::endl;
+        return EqualityError;
+    }
+    const double shift = std::acos(-1.0) / 2.0;
+    auto expected = QuantumCircuit(2, 2);
+    expected.rx(0.1, 0);
+    expected.ry(0.2, 1);
+    expected.rz(0.1 - shift, 1);
+    expected.measure(0, 0);
+    expected.measure(1, 1);
+    if (pubs[5].circuit() != expected || pubs[5].shots() != 100) {
+        std::cerr << "  parameter_shift test : wrong shifted circuit" << std::endl;
+        return EqualityError;
+    }
+
+    // (+, -) pairs are subtracted and summed for each parameter
+    primitives::PrimitiveResult result;
+    result.allocate(6);
+    for (uint_t i = 0; i < 6; i++) {
+        result[i].data("c").allocate(i + 1, 2);
+    }
+    auto cost = [](primitives::SamplerPubResult &pub) { return (double)pub.data("c").num_shots(); };
+    if (grad.gradient(result, cost) != std::vector<double>({-0.5, -1.0})) {
+        std::cerr << "  parameter_shift test : wrong gradient of cost" << std::endl;
+        return EqualityError;
+    }
+
+    // one template for each measurement basis of the observable
+    auto unmeasured = QuantumCircuit(2, 0);
+    unmeasured.rx(theta, 0);
+    unmeasured.ry(phi, 1);
+    unmeasured.rz(theta, 1);
+    std::vector<std::pair<std::string, std::complex<double>>> terms = {{"ZZ", 1.0}, {"XI", 0.5}};
+    auto obs = quantum_info::SparseObservable::from_list(terms);
+    primitives::ParameterShiftGradient obs_grad(unmeasured, obs);
+    if (!obs_grad.is_valid() || obs_grad.templates().size() != 2 || obs_grad.num_circuits() != 12) {
+        std::cerr << "  parameter_shift test : wrong templates of observable" << std::endl;
+        return EqualityError;
+    }
+    auto rotation = obs_grad.templates()[1][3];
+    if (rotation.instruction().name() != "h" || rotation.qubits()[0] != 1 || obs_grad.templates()[1].num_instructions() != 5) {
+        std::cerr << "  parameter_shift test : wrong basis change" << std::endl;
+        return EqualityError;
+    }
+    result.allocate(0);
+    result.allocate(12);
+    for (uint_t i = 0; i < 12; i++) {
+        auto &bits = result[i].data("meas");
+        bits.allocate(1, 2);
+        // ZZ = +1/-1 in the first group, XI = +0.5/-0.5 in the second group
+        bits[0].set(i < 6 ? 0 : 1, i % 2);
+    }
+    if (obs_grad.gradient(result) != std::vector<double>({1.5, 3.0})) {
+        std::cerr << "  parameter_shift test : wrong gradient of observable" << std::endl;
+        return EqualityError;
+    }
+
+    // parameters in expressions are not supported
+    auto expr = QuantumCircuit(1, 1);
+    expr.rx(theta * 2.0, 0);
+    if (primitives::ParameterShiftGradient(expr).is_valid()) {
+        std::cerr << "  parameter_shift test : expression is accepted" << std::endl;
+        return EqualityError;
+    }
+    return Ok;
+}
+
 static int test_measure(void) {
     uint_t num_qubits = 4;
     auto qr = QuantumRegister(num_qubits);
@@ -565,6 +1184,40 @@ static int test_append(void) {
     return Ok;
 }
 
+static int test_append_batch(void) {
+    uint_t num_qubits = 3;
+    auto circ = QuantumCircuit(num_qubits, num_qubits);
+    auto ref = QuantumCircuit(num_qubits, num_qubits);
+
+    ref.h(0);
+    ref.cx(0, 1);
+    ref.rz(0.5, 1);
+    ref.u(0.1, 0.2, 0.3, 2);
+    ref.ccx(0, 1, 2);
+
+    std::vector<QkGate> gates = {QkGate_H, QkGate_CX, QkGate_RZ, QkGate_U, QkGate_CCX};
+    std::vector<std::uint32_t> qubits = {0, 0, 1, 1, 2, 0, 1, 2};
+    std::vector<double> params = {0.5, 0.1, 0.2, 0.3};
+    if (!circ.append_batch(gates, qubits, params)) {
+        std::cerr << "  append_batch test : valid block is rejected" << std::endl;
+        return EqualityError;
+    }
+    if (circ != ref) {
+        std::cerr << "  append_batch test : batched circuit differs from reference" << std::endl;
+        circ.print();
+        return EqualityError;
+    }
+
+    // invalid blocks must not append anything
+    uint_t num_inst = circ.num_instructions();
+    if (circ.append_batch({QkGate_CX}, {0}) || circ.append_batch({QkGate_H}, {(std::uint32_t)num_qubits}) ||
+        circ.append_batch({QkGate_H, QkGate_CX}, {0, 1, 1}) || circ.num_instructions() != num_inst) {
+        std::cerr << "  append_batch test : invalid block is appended" << std::endl;
+        return EqualityError;
+    }
+    return Ok;
+}
+
 static int test_compose(void) {
     uint_t num_qubits = 4;
     auto circ = QuantumCircuit(num_qubits, num_qubits);
@@ -612,6 +1265,65 @@ static int test_compose(void) {
     return Ok;
 }
 
+static int test_compose_all_kinds(void) {
+    auto sub = QuantumCircuit(2, 2);
+    std::vector<complex_t> swap_mat = {1.0, 0.0, 0.0, 0.0,
+                                       0.0, 0.0, 1.0, 0.0,
+                                       0.0, 1.0, 0.0, 0.0,
+                                       0.0, 0.0, 0.0, 1.0};
+    sub.h(0);
+    sub.unitary(swap_mat, reg_t({0, 1}));
+    sub.barrier(reg_t({0, 1}));
+    sub.reset(1);
+    sub.measure(0, 1);
+
+    // identity mapping
+    auto same = QuantumCircuit(2, 2);
+    same.compose(sub, reg_t({0, 1}), reg_t({0, 1}));
+    if (same != sub) {
+        std::cerr << "  compose all kinds test : identity compose differs from the source" << std::endl;
+        same.print();
+        return EqualityError;
+    }
+
+    // permuted mapping, composed twice to check unitaries of composed circuits are kept
+    auto wide = QuantumCircuit(4, 4);
+    wide.compose(same, reg_t({3, 1}), reg_t({2, 0}));
+    auto wider = QuantumCircuit(4, 4);
+    wider.compose(wide);
+    if (wider.num_instructions() != sub.num_instructions()) {
+        std::cerr << "  compose all kinds test : number of instruction " << sub.num_instructions() << " != " << wider.num_instructions() << std::endl;
+        return EqualityError;
+    }
+    for (auto inst : wider.instructions()) {
+        auto qubits = inst.qubits();
+        bool ok = true;
+        switch (inst.index()) {
+        case 1:
+            ok = inst.kind() == QkOperationKind_Unitary && qubits.size() == 2 && qubits[0] == 3 && qubits[1] == 1;
+            break;
+        case 3:
+            ok = inst.kind() == QkOperationKind_Reset && qubits[0] == 1;
+            break;
+        case 4:
+            ok = inst.kind() == QkOperationKind_Measure && qubits[0] == 3 && inst.clbits()[0] == 0;
+            break;
+        default:
+            break;
+        }
+        if (!ok) {
+            std::cerr << "  compose all kinds test : instruction " << inst.index() << " " << inst.name() << " is not mapped correctly" << std::endl;
+            return EqualityError;
+        }
+    }
+    auto measures = wider.get_measure_map();
+    if (measures.size() != 1 || measures[0].first != 3 || measures[0].second != 0) {
+        std::cerr << "  compose all kinds test : measure map is not remapped" << std::endl;
+        return EqualityError;
+    }
+    return Ok;
+}
+
 static int test_to_qasm3_multi_regs(void) {
     auto qreg1 = QuantumRegister(2, std::string("q1"));
     auto qreg2 = QuantumRegister(1, std::string("q2"));
@@ -641,6 +1353,180 @@ static int test_to_qasm3_multi_regs(void) {
     return Ok;
 }
 
+static int test_to_qasm3_inputs(void) {
+    auto qreg = QuantumRegister(2, std::string("q"));
+    auto creg = ClassicalRegister(2, std::string("c"));
+    auto circ = QuantumCircuit(qreg, creg);
+    circ.rx(Parameter("theta"), 0);
+    circ.ry(Parameter("v[1]"), 1);
+    circ.measure(0, 0);
+
+    const auto actual = circ.to_qasm3();
+    const std::string expected =
+        "OPENQASM 3.0;\n"
+        "include \"stdgates.inc\";\n"
+        "input float[64] theta;\n"
+        "input float[64] v_1_;\n"
+        "qubit[2] q;\n"
+        "bit[2] c;\n"
+        "rx(theta) q[0];\n"
+        "ry(v_1_) q[1];\n"
+        "c[0] = measure q[0];\n";
+    if (actual != expected) {
+        std::cerr << "  to_qasm3_inputs test : \n    expected:\n" << expected
+            << "\n    actual:\n" << actual << std::endl;
+        return EqualityError;
+    }
+    return Ok;
+}
+
+static int test_to_qasm3_unique_inputs(void) {
+    auto qreg = QuantumRegister(2, std::string("q"));
+    auto creg = ClassicalRegister(2, std::string("c"));
+    auto circ = QuantumCircuit(qreg, creg);
+    circ.rx(Parameter("\xce\xb8"), 0);    // theta
+    circ.ry(Parameter("\xcf\x86"), 1);    // phi
+    circ.rz(Parameter("a[1]"), 0);
+    circ.rz(Parameter("a_1_"), 1);
+
+    // identifiers are unique, and names which are identifiers are kept
+    const auto actual = circ.to_qasm3();
+    const std::string expected =
+        "OPENQASM 3.0;\n"
+        "include \"stdgates.inc\";\n"
+        "input float[64] a_1__1;\n"
+        "input float[64] a_1_;\n"
+        "input float[64] _xce_xb8;\n"
+        "input float[64] _xcf_x86;\n"
+        "qubit[2] q;\n"
+        "bit[2] c;\n"
+        "rx(_xce_xb8) q[0];\n"
+        "ry(_xcf_x86) q[1];\n"
+        "rz(a_1__1) q[0];\n"
+        "rz(a_1_) q[1];\n";
+    if (actual != expected) {
+        std::cerr << "  to_qasm3_unique_inputs test : \n    expected:\n" << expected
+            << "\n    actual:\n" << actual << std::endl;
+        return EqualityError;
+    }
+
+    // a name which is a prefix of another name is not replaced in the other name
+    auto theta = Parameter("\xce\xb8");
+    auto vec = QuantumCircuit(qreg, creg);
+    vec.rx(theta, 0);
+    vec.ry(Parameter("\xce\xb8[0]"), 0);
+    vec.rz(Parameter("\xce\xb8[1]"), 1);
+    const std::string vec_expected =
+        "OPENQASM 3.0;\n"
+        "include \"stdgates.inc\";\n"
+        "input float[64] _xce_xb8;\n"
+        "input float[64] _xce_xb8_0_;\n"
+        "input float[64] _xce_xb8_1_;\n"
+        "qubit[2] q;\n"
+        "bit[2] c;\n"
+        "rx(_xce_xb8) q[0];\n"
+        "ry(_xce_xb8_0_) q[0];\n"
+        "rz(_xce_xb8_1_) q[1];\n";
+    if (vec.to_qasm3() != vec_expected) {
+        std::cerr << "  to_qasm3_unique_inputs test : \n    expected:\n" << vec_expected
+            << "\n    actual:\n" << vec.to_qasm3() << std::endl;
+        return EqualityError;
+    }
+
+    // values are ordered by the identifiers
+    primitives::SamplerPub pub(circ, std::vector<std::vector<double>>({{1.0, 2.0, 3.0, 4.0}}));
+    auto js = pub.to_json();
+    if (js[1] != nlohmann::ordered_json::parse("[[3.0, 4.0, 2.0, 1.0]]")) {
+        std::cerr << "  to_qasm3_unique_inputs test : wrong order of values " << js[1].dump() << std::endl;
+        return EqualityError;
+    }
+    return Ok;
+}
+
+static int test_sampler_pub_bindings(void) {
+    auto qreg = QuantumRegister(2, std::string("q"));
+    auto creg = ClassicalRegister(2, std::string("c"));
+    auto circ = QuantumCircuit(qreg, creg);
+    circ.rx(Parameter("theta"), 0);
+    circ.ry(Parameter("v[1]"), 1);
+    circ.measure(0, 0);
+
+    // columns are reordered to the circuit order
+    primitives::SamplerPub pub(circ, std::vector<std::string>({"v[1]", "theta"}), std::vector<double>({1.0, 2.0, 3.0, 4.0}), 10);
+    if (pub.num_bindings() != 2 || pub.shape() != reg_t({2}) || pub.values() != std::vector<double>({2.0, 1.0, 4.0, 3.0})) {
+        std::cerr << "  sampler_pub_bindings test : wrong bindings" << std::endl;
+        return EqualityError;
+    }
+    auto expected = QuantumCircuit(qreg, creg);
+    expected.rx(4.0, 0);
+    expected.ry(3.0, 1);
+    expected.measure(0, 0);
+    if (pub.bound_circuit(1) != expected) {
+        std::cerr << "  sampler_pub_bindings test : wrong bound circuit" << std::endl;
+        return EqualityError;
+    }
+    auto js = pub.to_json();
+    if (js.size() != 3 || js[1] != nlohmann::ordered_json::parse("[[2.0, 1.0], [4.0, 3.0]]") || js[2] != 10) {
+        std::cerr << "  sampler_pub_bindings test : wrong JSON " << js.dump() << std::endl;
+        return EqualityError;
+    }
+
+    // a single binding is broadcast to the shape
+    primitives::SamplerPub broadcast(circ, std::vector<double>({0.5, 0.25}), reg_t({2, 3}));
+    if (broadcast.num_bindings() != 6 || broadcast.to_json()[1][1][2] != nlohmann::ordered_json::parse("[0.5, 0.25]")) {
+        std::cerr << "  sampler_pub_bindings test : values are not broadcast" << std::endl;
+        return EqualityError;
+    }
+    primitives::SamplerPub wrong(circ, std::vector<double>({0.5, 0.25, 1.0}), reg_t({2}));
+    if (wrong.num_bindings() != 1 || wrong.params().size() != 0) {
+        std::cerr << "  sampler_pub_bindings test : wrong number of values is accepted" << std::endl;
+        return EqualityError;
+    }
+
+    // samples are returned for each binding
+    primitives::SamplerPubResult result;
+    result.set_pub(pub);
+    auto output = nlohmann::ordered_json::parse("{\"data\": {\"c\": {\"samples\": [[\"0x1\", \"0x0\"], [\"0x3\", \"0x2\"]], \"num_bits\": 2}}}");
+    result.from_json(output);
+    auto bits = result.data("c", 1);
+    if (result.num_bindings() != 2 || result.data("c").num_bindings() != 2 || bits.num_shots() != 2 ||
+        bits[0].get(0) != 1 || bits[0].get(1) != 1 || bits[1].get(0) != 0 || bits[1].get(1) != 1) {
+        std::cerr << "  sampler_pub_bindings test : wrong samples of binding" << std::endl;
+        return EqualityError;
+    }
+    return Ok;
+}
+
+static int test_if_else_bodies(void) {
+    auto qreg = QuantumRegister(2, std::string("q"));
+    auto creg = ClassicalRegister(2, std::string("c"));
+    auto circ = QuantumCircuit(qreg, creg);
+    circ.h(0);
+    circ.measure(0, 0);
+    auto shared = circ;
+
+    // bodies are empty circuits with the registers of the parent
+    auto &op = circ.if_test(0, 1, [](QuantumCircuit &body) { body.x(1); });
+    op.else_([](QuantumCircuit &body) { body.z(1); });
+    if (op.true_body().num_instructions() != 1 || op.false_body().num_instructions() != 1 ||
+        op.true_body().num_qubits() != 2 || op.true_body().num_clbits() != 2 ||
+        op.false_body().num_qubits() != 2 || op.false_body().num_clbits() != 2) {
+        std::cerr << "  if_else_bodies test : wrong bodies" << std::endl;
+        return EqualityError;
+    }
+    if (op.true_body().get_rust_circuit() == circ.get_rust_circuit(false)) {
+        std::cerr << "  if_else_bodies test : body shares the parent circuit" << std::endl;
+        return EqualityError;
+    }
+
+    // adding the pending operation does not modify or copy the parent
+    if (circ.get_rust_circuit() != shared.get_rust_circuit(false) || circ.num_instructions() != 2) {
+        std::cerr << "  if_else_bodies test : parent circuit is modified" << std::endl;
+        return EqualityError;
+    }
+    return Ok;
+}
+
 #if defined(_WIN32)
 int test_circuit(int argc, char** const argv) {
 #else
@@ -648,10 +1534,28 @@ int test_circuit(int argc, char** argv) {
 #endif
     int num_failed = 0;
     num_failed += RUN_TEST(test_standard_gates);
+    num_failed += RUN_TEST(test_standard_gate_table);
+    num_failed += RUN_TEST(test_instructions);
+    num_failed += RUN_TEST(test_copy_on_write);
+    num_failed += RUN_TEST(test_fingerprint);
+    num_failed += RUN_TEST(test_equals);
+    num_failed += RUN_TEST(test_metrics);
+    num_failed += RUN_TEST(test_reduce_to_lightcone);
+    num_failed += RUN_TEST(test_broadcast);
+    num_failed += RUN_TEST(test_assign_parameters);
+    num_failed += RUN_TEST(test_parameter_table);
+    num_failed += RUN_TEST(test_bind_sweep);
+    num_failed += RUN_TEST(test_parameter_shift);
     num_failed += RUN_TEST(test_measure);
     num_failed += RUN_TEST(test_append);
+    num_failed += RUN_TEST(test_append_batch);
     num_failed += RUN_TEST(test_compose);
+    num_failed += RUN_TEST(test_compose_all_kinds);
     num_failed += RUN_TEST(test_to_qasm3_multi_regs);
+    num_failed += RUN_TEST(test_to_qasm3_inputs);
+    num_failed += RUN_TEST(test_to_qasm3_unique_inputs);
+    num_failed += RUN_TEST(test_sampler_pub_bindings);
+    num_failed += RUN_TEST(test_if_else_bodies);
 
     std::cerr << "=== Number of failed subtests: " << num_failed << std::endl;
     return num_failed;
@@ -17,6 +17,7 @@
 #include "common.hpp"
 
 #include "circuit/parameter.hpp"
+#include "circuit/compiled_expression.hpp"
 using namespace Qiskit;
 using namespace Qiskit::circuit;
 
@@ -327,9 +328,172 @@ int test_parameter_copy(void) {
         result = EqualityError;
     }
 
+    // copies are separated when modified in place
+    Parameter assigned = Parameter();
+    assigned = sum;
+    assigned += x;
+    copy *= y;
+    if (sum != x + y || assigned != x + y + x || copy != (x + y) * y) {
+        std::cerr << "Modifying a copy changes the original" << std::endl;
+        result = EqualityError;
+    }
+
+    // moved Parameter is left as zero
+    Parameter moved(std::move(assigned));
+    if (moved != x + y + x || !assigned.is_numeric() || assigned != 0.0) {
+        std::cerr << "Move is wrong" << std::endl;
+        result = EqualityError;
+    }
     return result;
 }
 
+/**
+ * Test expressions reusing temporaries.
+ */
+static int test_parameter_expression(void) {
+    auto a = Parameter("a");
+    auto b = Parameter("b");
+    auto c = Parameter("c");
+
+    Parameter step = a * 2.0;
+    step = step + b;
+    step = step / c;
+    auto expr = (a * 2.0 + b) / c;
+    if (expr != step) {
+        std::cerr << "Expression " << expr << " is not " << step << std::endl;
+        return EqualityError;
+    }
+    if (2.0 * a != Parameter(2.0) * a || 1.0 - a != Parameter(1.0) - a) {
+        std::cerr << "Operations with a value on the left are wrong" << std::endl;
+        return EqualityError;
+    }
+    // operands are not modified
+    if (a != Parameter(a) || a.symbols() != std::vector<std::string>({"a"}) || b.symbols() != std::vector<std::string>({"b"})) {
+        std::cerr << "Operand is modified by an expression" << std::endl;
+        return EqualityError;
+    }
+    return Ok;
+}
+
+/**
+ * Test extracting symbol names from expressions.
+ */
+static int test_parameter_symbols(void) {
+    auto a = Parameter("alpha");
+    auto b = Parameter("beta_1");
+    auto expr = (a * 2.0e-3 + b).sin() * a;
+
+    std::vector<std::string> expected = {"alpha", "beta_1"};
+    if (expr.symbols() != expected) {
+        std::cerr << "Symbols of " << expr.as_str() << " are not alpha, beta_1" << std::endl;
+        return EqualityError;
+    }
+
+    std::vector<std::string> names;
+    Parameter::parse_symbols("cos(theta[10]) + 2*theta[2] - 1.5e-3*phi", names);
+    std::sort(names.begin(), names.end(), Parameter::symbol_less);
+    expected = {"phi", "theta[2]", "theta[10]"};
+    if (names != expected) {
+        std::cerr << "Symbols are not sorted as phi, theta[2], theta[10]" << std::endl;
+        return EqualityError;
+    }
+    return Ok;
+}
+
+/**
+ * Test compiling expressions and evaluating them natively.
+ */
+static int test_compiled_expression(void) {
+    std::vector<std::string> symbols = {"phi", "theta[0]", "theta[1]"};
+    CompiledExpression expr;
+    if (!expr.compile("2*theta[1] + phi**2 - sin(theta[0])/2", symbols)) {
+        std::cerr << "Expression is not compiled" << std::endl;
+        return EqualityError;
+    }
+    double values[3] = {0.5, 0.3, -1.25};
+    double expected = 2 * values[2] + values[0] * values[0] - std::sin(values[1]) / 2;
+    if (std::fabs(expr.evaluate(values) - expected) > 1e-12) {
+        std::cerr << "Compiled expression is evaluated to " << expr.evaluate(values) << ", not " << expected << std::endl;
+        return EqualityError;
+    }
+
+    // many sets at once
+    const uint_t num_sets = 100;
+    std::vector<double> sets(num_sets * 3);
+    for (uint_t i = 0; i < sets.size(); i++) {
+        sets[i] = 0.01 * i;
+    }
+    std::vector<double> out(num_sets);
+    expr.evaluate(sets.data(), num_sets, 3, out.data());
+    for (uint_t i = 0; i < num_sets; i++) {
+        if (std::fabs(out[i] - expr.evaluate(sets.data() + i * 3)) > 1e-12) {
+            std::cerr << "Compiled expression of set " << i << " is wrong" << std::endl;
+            return EqualityError;
+        }
+    }
+
+    // precedence and folding of numbers
+    double a = 1.5;
+    if (!expr.compile("-a**2 + 2*3", {"a"}) || std::fabs(expr.evaluate(&a) - (6.0 - a * a)) > 1e-12 || expr.code().size() != 6) {
+        std::cerr << "Precedence or folding of compiled expression is wrong" << std::endl;
+        return EqualityError;
+    }
+    if (!expr.compile("(1 + 2)*4/2", {}) || !expr.is_constant() || expr.evaluate(nullptr) != 6.0) {
+        std::cerr << "Numbers are not folded" << std::endl;
+        return EqualityError;
+    }
+
+    // unknown symbols, functions and complex numbers are not compiled
+    if (expr.compile("2*x", symbols) || expr.compile("foo(phi)", symbols) || expr.compile("1.5i*phi", symbols) || expr.compile("phi +", symbols)) {
+        std::cerr << "Invalid expression is compiled" << std::endl;
+        return EqualityError;
+    }
+
+    // from Parameter
+    auto theta = Parameter("theta");
+    auto phi = Parameter("phi");
+    CompiledExpression compiled(theta * 2.0 + phi);
+    double tp[2] = {0.25, 0.5};  // phi, theta
+    if (!compiled.is_valid() || std::fabs(compiled.evaluate(tp) - 1.25) > 1e-12) {
+        std::cerr << "Compiled Parameter " << (theta * 2.0 + phi) << " is wrong" << std::endl;
+        return EqualityError;
+    }
+    return Ok;
+}
+
+/**
+ * Test arithmetic of numbers without QkParam.
+ */
+static int test_parameter_numeric(void) {
+    auto two = Parameter(2.0);
+    auto three = Parameter(3.0);
+    auto ret = (two * three + 1.0).pow(2.0) / 7.0;
+    if (!ret.is_real() || ret != 7.0 || ret.as_real() != 7.0) {
+        std::cerr << "Numbers are not folded: " << ret << std::endl;
+        return EqualityError;
+    }
+    ret -= 1.0;
+    ret *= Parameter(0.5);
+    if (!ret.is_numeric() || ret.as_real() != 3.0) {
+        std::cerr << "Compound operations of numbers are wrong: " << ret << std::endl;
+        return EqualityError;
+    }
+    if (Parameter(0.0).cos().as_real() != 1.0 || !Parameter(std::complex<double>(1.0, 2.0)).conjugate().is_numeric() || Parameter(-1.5).sign() != -1.0) {
+        std::cerr << "Functions of numbers are wrong" << std::endl;
+        return EqualityError;
+    }
+
+    // a number becomes symbolic with a symbol
+    auto a = Parameter("a");
+    ret = three;
+    ret += a;
+    if (ret.is_numeric() || (two + a).is_numeric() || ret.symbols() != std::vector<std::string>({"a"}) || three.as_real() != 3.0) {
+        std::cerr << "Number is not promoted to an expression" << std::endl;
+        return EqualityError;
+    }
+    return Ok;
+}
+
 #if defined(_WIN32)
 int test_parameter(int argc, char** const argv) {
 #else
@@ -344,6 +508,10 @@ int test_parameter(int argc, char** argv) {
     num_failed += RUN_TEST(test_parameter_binary_ops);
     num_failed += RUN_TEST(test_parameter_unary_ops);
     num_failed += RUN_TEST(test_parameter_with_value);
+    num_failed += RUN_TEST(test_parameter_symbols);
+    num_failed += RUN_TEST(test_parameter_numeric);
+    num_failed += RUN_TEST(test_parameter_expression);
+    num_failed += RUN_TEST(test_compiled_expression);
 
     std::cerr << "=== Number of failed subtests: " << num_failed << std::endl;
 
@@ -10,6 +10,7 @@
 // copyright notice, and modified files need to carry a notice indicating
 // that they have been altered from the originals.
 
+#include <algorithm>
 #include <iostream>
 #include <cstdint>
 #define _USE_MATH_DEFINES
@@ -17,11 +18,19 @@
 
 #include "circuit/quantumcircuit.hpp"
 #include "transpiler/passmanager.hpp"
+#include "transpiler/transpile_cache.hpp"
+#include "transpiler/transpiled_template.hpp"
+#include "transpiler/transpile_stats.hpp"
+#include "transpiler/basepasses.hpp"
+#include "transpiler/scheduling.hpp"
+#include "transpiler/preset_passmanagers/generate_preset_pass_manager.hpp"
+#include "primitives/circuit_packer.hpp"
 #include "common.hpp"
 
 using namespace Qiskit;
 using namespace Qiskit::circuit;
 using namespace Qiskit::transpiler;
+using namespace Qiskit::primitives;
 
 
 static int test_translate_h(void)
@@ -119,6 +128,521 @@ static int test_ghz_routing(void)
     return Ok;
 }
 
+static int test_subtarget(void)
+{
+    auto target = Target({"sx", "rz", "cz"}, {{0, 1}, {1, 2}, {2, 3}, {3, 4}});
+    auto sub = target.subtarget({3, 2});
+    auto coupling_map = sub.coupling_map();
+
+    std::vector<std::pair<uint32_t, uint32_t>> expected = {{1, 0}};
+    if (coupling_map != expected) {
+        std::cerr << "  subtarget test : wrong coupling map of subtarget" << std::endl;
+        return EqualityError;
+    }
+    return Ok;
+}
+
+static int test_pack_regions(void)
+{
+    std::vector<std::pair<uint32_t, uint32_t>> line;
+    for (uint32_t i = 0; i < 9; i++) {
+        line.push_back(std::make_pair(i, i + 1));
+    }
+
+    std::vector<std::vector<uint32_t>> regions;
+    if (!CircuitPacker::find_regions(line, 10, {2, 3}, 1, regions)) {
+        std::cerr << "  pack regions test : regions are not found" << std::endl;
+        return EqualityError;
+    }
+    std::vector<std::vector<uint32_t>> expected = {{4, 5}, {0, 1, 2}};
+    if (regions != expected) {
+        std::cerr << "  pack regions test : wrong regions" << std::endl;
+        return EqualityError;
+    }
+    if (CircuitPacker::find_regions(line, 10, {5, 5}, 1, regions)) {
+        std::cerr << "  pack regions test : regions closer than separation are found" << std::endl;
+        return EqualityError;
+    }
+    return Ok;
+}
+static int test_pack_unpack(void)
+{
+    QuantumRegister qr0(2);
+    ClassicalRegister cr0(2, std::string("c"));
+    QuantumCircuit circ0(qr0, cr0);
+    circ0.x(0);
+    circ0.measure(qr0, cr0);
+
+    QuantumRegister qr1(2);
+    ClassicalRegister cr1a(1, std::string("a"));
+    ClassicalRegister cr1b(1, std::string("b"));
+    QuantumCircuit circ1(std::vector<QuantumRegister>({qr1}), std::vector<ClassicalRegister>({cr1a, cr1b}));
+    circ1.x(1);
+    circ1.measure(0, 0);
+    circ1.measure(1, 1);
+
+    auto target = Target({"cz", "rz", "sx", "x"}, {{0, 1}, {1, 0}, {1, 2}, {2, 1}, {2, 3}, {3, 2}, {3, 4}, {4, 3}, {4, 5}, {5, 4}});
+    CircuitPacker packer(target, 1, 1, 7);
+    if (!packer.pack({circ0, circ1})) {
+        std::cerr << "  pack unpack test : circuits are not packed" << std::endl;
+        return EqualityError;
+    }
+    std::vector<std::vector<uint32_t>> expected = {{0, 1}, {3, 4}};
+    if (packer.regions() != expected) {
+        std::cerr << "  pack unpack test : wrong regions" << std::endl;
+        return EqualityError;
+    }
+
+    // measurements of each circuit go to its region and its pack<i> register
+    auto &packed = packer.packed_circuit();
+    auto &measures = packed.get_measure_map();
+    if (packed.num_qubits() != 6 || packed.num_clbits() != 4 || measures.size() != 4) {
+        std::cerr << "  pack unpack test : wrong packed circuit" << std::endl;
+        return EqualityError;
+    }
+    reg_t measured(4, 0);
+    for (auto &m : measures) {
+        auto &region = expected[m.second < 2 ? 0 : 1];
+        if (m.second >= 4 || std::find(region.begin(), region.end(), (uint32_t)m.first) == region.end()) {
+            std::cerr << "  pack unpack test : qubit " << m.first << " is measured to clbit " << m.second << std::endl;
+            return EqualityError;
+        }
+        measured[m.second]++;
+    }
+    if (measured != reg_t({1, 1, 1, 1})) {
+        std::cerr << "  pack unpack test : clbits are not measured once" << std::endl;
+        return EqualityError;
+    }
+
+    // samples of pack<i> are split into registers of each circuit
+    SamplerPubResult packed_result;
+    packed_result.set_pub(SamplerPub(packed));
+    auto output = nlohmann::ordered_json::parse("{\"data\": {\"pack0\": {\"samples\": [\"0x1\", \"0x3\"], \"num_bits\": 2}, "
+                                                "\"pack1\": {\"samples\": [\"0x2\", \"0x1\"], \"num_bits\": 2}}}");
+    if (!packed_result.from_json(output)) {
+        std::cerr << "  pack unpack test : samples are not read" << std::endl;
+        return EqualityError;
+    }
+    auto result = packer.unpack(packed_result);
+    if (result.size() != 2) {
+        std::cerr << "  pack unpack test : wrong number of results" << std::endl;
+        return EqualityError;
+    }
+    auto &c = result[0].data("c");
+    auto &a = result[1].data("a");
+    auto &b = result[1].data("b");
+    if (c.num_bits() != 2 || c.num_shots() != 2 || c[0].get(0) != 1 || c[0].get(1) != 0 || c[1].get(0) != 1 || c[1].get(1) != 1) {
+        std::cerr << "  pack unpack test : wrong bits of circuit 0" << std::endl;
+        return EqualityError;
+    }
+    if (a.num_bits() != 1 || b.num_bits() != 1 || a.num_shots() != 2 || b.num_shots() != 2 ||
+        a[0].get(0) != 0 || b[0].get(0) != 1 || a[1].get(0) != 1 || b[1].get(0) != 0) {
+        std::cerr << "  pack unpack test : wrong bits of circuit 1" << std::endl;
+        return EqualityError;
+    }
+    return Ok;
+}
+static int test_transpile_cache(void)
+{
+    QuantumRegister qr(2);
+    ClassicalRegister cr(2);
+    QuantumCircuit circ(qr, cr);
+    circ.h(0);
+    circ.cx(0, 1);
+    circ.measure(qr, cr);
+
+    auto target = Target({"cz", "rz", "sx"}, {{0, 1}, {1, 0}});
+    TranspileCache cache(1, ".");
+    auto pass = StagedPassManager(default_stages, target, 1, 1.0, 7);
+    pass.set_cache(&cache);
+
+    auto transpiled = pass.run(circ);
+    auto cached = pass.run(circ);
+    if (cache.hits() != 1 || cache.misses() != 1 || cached != transpiled || cached.get_qubit_map() != transpiled.get_qubit_map()) {
+        std::cerr << "  transpile cache test : transpiled circuit is not cached" << std::endl;
+        return EqualityError;
+    }
+
+    // circuits with the same structure share the entry
+    QuantumRegister qr2(2);
+    ClassicalRegister cr2(2);
+    QuantumCircuit same(qr2, cr2);
+    same.h(0);
+    same.cx(0, 1);
+    same.measure(qr2, cr2);
+    pass.run(same);
+    if (cache.hits() != 2) {
+        std::cerr << "  transpile cache test : circuit of the same structure is not found" << std::endl;
+        return EqualityError;
+    }
+
+    // other options are other entries, and the LRU entry is removed
+    auto other_seed = StagedPassManager(default_stages, target, 1, 1.0, 8);
+    other_seed.set_cache(&cache);
+    other_seed.run(circ);
+    if (cache.misses() != 2 || cache.size() != 1) {
+        std::cerr << "  transpile cache test : wrong entries for other options" << std::endl;
+        return EqualityError;
+    }
+
+    // entries are read from the directory by other caches
+    TranspileCache disk(4, ".");
+    pass.set_cache(&disk);
+    auto loaded = pass.run(circ);
+    std::remove(("./" + TranspileCache::key(circ, target, 1, 1.0, 7, default_stages).to_string() + ".json").c_str());
+    std::remove(("./" + TranspileCache::key(circ, target, 1, 1.0, 8, default_stages).to_string() + ".json").c_str());
+    if (disk.disk_hits() != 1 || loaded != transpiled || loaded.get_qubit_map() != transpiled.get_qubit_map()) {
+        std::cerr << "  transpile cache test : entry is not read from the directory" << std::endl;
+        return EqualityError;
+    }
+
+    // circuits with symbolic parameters are only kept in memory
+    QuantumCircuit sym(qr, cr);
+    sym.rx(Parameter("theta"), 0);
+    sym.measure(qr, cr);
+    auto sym_transpiled = pass.run(sym);
+    auto sym_cached = pass.run(sym);
+    std::string sym_file = "./" + TranspileCache::key(sym, target, 1, 1.0, 7, default_stages).to_string() + ".json";
+    bool written = std::ifstream(sym_file).good();
+    std::remove(sym_file.c_str());
+    if (written || disk.hits() != 2 || sym_cached != sym_transpiled) {
+        std::cerr << "  transpile cache test : circuit with symbols is written to the directory" << std::endl;
+        return EqualityError;
+    }
+
+    // the hash of the target is kept until the target is modified
+    auto fp = target.fingerprint();
+    InstructionProperty prop;
+    prop.qargs = {0};
+    prop.duration = 1e-8;
+    target.add_instruction(Instruction("x", 1, QkGate_X), {prop});
+    if (target.fingerprint() == fp || Target(target).fingerprint() != target.fingerprint()) {
+        std::cerr << "  transpile cache test : hash of the target is not updated" << std::endl;
+        return EqualityError;
+    }
+    return Ok;
+}
+
+static int test_parallel_run(void)
+{
+    std::vector<QuantumCircuit> circuits;
+    for (int i = 0; i < 16; i++) {
+        QuantumRegister qr(2);
+        ClassicalRegister cr(2);
+        QuantumCircuit circ(qr, cr);
+        circ.h(0);
+        circ.rz(0.1 * i, 1);
+        circ.cx(0, 1);
+        circ.measure(qr, cr);
+        circuits.push_back(circ);
+    }
+
+    auto target = Target({"cz", "rz", "sx"}, {{0, 1}, {1, 0}});
+    auto pass = StagedPassManager(default_stages, target, 1, 1.0, 7);
+    ThreadPool pool(4);
+    auto output = pass.run(circuits, pool);
+    if (output.size() != circuits.size()) {
+        std::cerr << "  parallel run test : wrong number of circuits " << output.size() << std::endl;
+        return EqualityError;
+    }
+
+    // each circuit is transpiled with its own seed, same as a serial run
+    for (int i = 0; i < (int)circuits.size(); i++) {
+        int seed = StagedPassManager::derive_seed(7, i);
+        if (seed < 0 || (i > 0 && seed == StagedPassManager::derive_seed(7, i - 1))) {
+            std::cerr << "  parallel run test : wrong seed " << seed << " for circuit " << i << std::endl;
+            return EqualityError;
+        }
+        auto serial = StagedPassManager(default_stages, target, 1, 1.0, seed).run(circuits[i]);
+        if (output[i] != serial || output[i].get_qubit_map() != serial.get_qubit_map()) {
+            std::cerr << "  parallel run test : circuit " << i << " is not the same as serial run" << std::endl;
+            return EqualityError;
+        }
+    }
+    if (StagedPassManager::derive_seed(-1, 3) != -1) {
+        std::cerr << "  parallel run test : negative seed is changed" << std::endl;
+        return EqualityError;
+    }
+    return Ok;
+}
+
+static int test_transpiled_template(void)
+{
+    auto theta = Parameter("theta");
+    auto phi = Parameter("phi");
+    auto circ = QuantumCircuit(2, 2);
+    circ.rx(theta, 0);
+    circ.cx(0, 1);
+    circ.rz(phi, 1);
+    circ.measure(0, 0);
+    circ.measure(1, 1);
+
+    auto target = Target({"cz", "rz", "sx"}, {{0, 1}, {1, 0}});
+    auto pass = StagedPassManager(default_stages, target, 1, 1.0, 7);
+    auto tmpl = pass.run_template(circ);
+    if (!tmpl.is_valid() || tmpl.num_parameters() != 2 || tmpl.parameter_names()[0] != "phi" ||
+        tmpl.circuit().num_parameters() != 2 || tmpl.slots("theta").size() == 0 || tmpl.slots("phi").size() == 0) {
+        std::cerr << "  transpiled template test : parameters are not mapped" << std::endl;
+        return EqualityError;
+    }
+
+    // bound templates are the transpiled circuit with values bound by name
+    // (transpiling bound circuits can give other circuits, e.g. by removing rotations of 0)
+    std::vector<std::vector<double>> values = {{0.2, 0.1}, {0.4, 0.3}, {0.6, 0.5}};
+    ThreadPool pool(4);
+    auto circuits = tmpl.bind_sweep(values, pool);
+    if (circuits.size() != values.size()) {
+        std::cerr << "  transpiled template test : " << circuits.size() << " circuits are returned" << std::endl;
+        return EqualityError;
+    }
+    for (uint_t i = 0; i < values.size(); i++) {
+        std::unordered_map<std::string, double> named;
+        for (uint_t j = 0; j < values[i].size(); j++) {
+            named[tmpl.parameter_names()[j]] = values[i][j];
+        }
+        auto expected = tmpl.circuit().bind_parameters(named);
+        if (circuits[i] != expected || circuits[i].num_parameters() != 0 || circuits[i].get_qubit_map() != expected.get_qubit_map()) {
+            std::cerr << "  transpiled template test : circuit " << i << " is wrong" << std::endl;
+            return EqualityError;
+        }
+        if (tmpl.bind(values[i]) != expected) {
+            std::cerr << "  transpiled template test : bind of set " << i << " is wrong" << std::endl;
+            return EqualityError;
+        }
+    }
+    if (tmpl.bind_sweep(std::vector<std::vector<double>>({{0.1}}), pool).size() != 0) {
+        std::cerr << "  transpiled template test : wrong number of values is accepted" << std::endl;
+        return EqualityError;
+    }
+    return Ok;
+}
+
+static int test_transpile_stats(void)
+{
+    QuantumRegister qr(3);
+    ClassicalRegister cr(3);
+    QuantumCircuit circ(qr, cr);
+    circ.h(0);
+    circ.cx(0, 1);
+    circ.cx(0, 2);
+    circ.measure(qr, cr);
+
+    auto target = Target({"cz", "rz", "sx"}, {{0, 1}, {1, 2}});
+    auto pass = StagedPassManager(default_stages, target, 1, 1.0, 7);
+    TranspileStats stats;
+    auto transpiled = pass.run(circ, stats);
+
+    // scheduling is not run
+    std::vector<std::string> names = {"init", "layout", "routing", "translation", "optimization"};
+    if (stats.size() != names.size() || stats.stage("scheduling") != nullptr) {
+        std::cerr << "  transpile stats test : " << stats.size() << " stages are recorded" << std::endl;
+        std::cerr << stats.to_string();
+        return EqualityError;
+    }
+    for (uint_t i = 0; i < names.size(); i++) {
+        const StageStats &stage = stats.stages()[i];
+        if (stage.name != names[i] || stage.time < 0.0 || stats.stage(names[i]) != &stage) {
+            std::cerr << "  transpile stats test : wrong stage " << stage.name << std::endl;
+            return EqualityError;
+        }
+        if (i > 0 && stage.size_before != stats.stages()[i - 1].size_after) {
+            std::cerr << "  transpile stats test : size before " << stage.name << " is not the size after the previous stage" << std::endl;
+            return EqualityError;
+        }
+    }
+    const StageStats &last = stats.stages().back();
+    if (stats.stages()[0].size_before != circ.metrics().size() || last.size_after != transpiled.metrics().size() ||
+        last.num_2q_gates != transpiled.num_nonlocal_gates() || last.depth != transpiled.depth()) {
+        std::cerr << "  transpile stats test : wrong metrics" << std::endl;
+        std::cerr << stats.to_string();
+        return EqualityError;
+    }
+    if (stats.total_time() < last.time) {
+        std::cerr << "  transpile stats test : wrong total time " << stats.total_time() << std::endl;
+        return EqualityError;
+    }
+    return Ok;
+}
+
+class CountOpsPass : public AnalysisPass {
+public:
+    std::vector<std::string> *log;
+    uint_t num_ops = 0;
+    bool has_state = false;
+
+    CountOpsPass(std::vector<std::string> *l) : log(l) {}
+
+    std::string name(void) const override
+    {
+        return "count_ops";
+    }
+
+    bool analyze(const QkDag *dag, const QkTarget *target, QkTranspilerStageState *state) override
+    {
+        log->push_back(name());
+        num_ops = qk_dag_num_op_nodes(dag);
+        has_state = (state != nullptr);
+        return target != nullptr;
+    }
+};
+
+class LogPass : public TransformationPass {
+public:
+    std::vector<std::string> *log;
+    bool result;
+
+    LogPass(std::vector<std::string> *l, const bool r = true) : log(l), result(r) {}
+
+    std::string name(void) const override
+    {
+        return "log";
+    }
+
+    bool transform(QkDag *, const QkTarget *, QkTranspilerStageState *) override
+    {
+        log->push_back(name());
+        return result;
+    }
+};
+
+static int test_user_passes(void)
+{
+    QuantumRegister qr(2);
+    ClassicalRegister cr(2);
+    QuantumCircuit circ(qr, cr);
+    circ.h(0);
+    circ.cx(0, 1);
+    circ.measure(qr, cr);
+
+    auto target = Target({"cz", "rz", "sx"}, {{0, 1}, {1, 0}});
+    auto pass = StagedPassManager(default_stages, target, 1, 1.0, 7);
+    std::vector<std::string> log;
+    auto before_layout = std::make_shared<CountOpsPass>(&log);
+    auto after_layout = std::make_shared<CountOpsPass>(&log);
+    if (!pass.add_pass_before("layout", before_layout) || !pass.add_pass_after("layout", after_layout) ||
+        !pass.add_pass_after("layout", std::make_shared<LogPass>(&log)) || pass.add_pass_after("unknown", std::make_shared<LogPass>(&log))) {
+        std::cerr << "  user passes test : passes are not added" << std::endl;
+        return EqualityError;
+    }
+
+    TranspileStats stats;
+    pass.run(circ, stats);
+    std::vector<std::string> expected = {"count_ops", "count_ops", "log"};
+    if (log != expected || before_layout->num_ops != circ.num_instructions() || before_layout->has_state || !after_layout->has_state) {
+        std::cerr << "  user passes test : passes are not run around the stage" << std::endl;
+        return EqualityError;
+    }
+    if (stats.size() != 8 || stats.stages()[1].name != "count_ops" || stats.stages()[4].name != "log") {
+        std::cerr << "  user passes test : passes are not recorded" << std::endl;
+        std::cerr << stats.to_string();
+        return EqualityError;
+    }
+
+    // a failing pass stops the transpilation
+    log.clear();
+    pass.add_pass_before("routing", std::make_shared<LogPass>(&log, false));
+    pass.add_pass_after("routing", std::make_shared<LogPass>(&log));
+    auto failed = pass.run(circ);
+    if (log.size() != 4 || failed != circ) {
+        std::cerr << "  user passes test : transpilation is not stopped by a failing pass" << std::endl;
+        return EqualityError;
+    }
+
+    pass.clear_passes();
+    if (pass.has_passes()) {
+        std::cerr << "  user passes test : passes are not removed" << std::endl;
+        return EqualityError;
+    }
+    return Ok;
+}
+
+static int test_scheduling(void)
+{
+    std::unordered_map<std::string, std::vector<InstructionProperty>> props;
+    props["x"] = {{{0}, 30e-9, 0.0}, {{1}, 30e-9, 0.0}};
+    props["cx"] = {{{0, 1}, 100e-9, 0.0}};
+    props["measure"] = {{{0}, 500e-9, 0.0}, {{1}, 500e-9, 0.0}};
+    Target target(props);
+
+    auto circ = QuantumCircuit(2, 2);
+    circ.x(0);
+    circ.x(0);
+    circ.x(1);
+    circ.cx(0, 1);
+    circ.measure(0, 0);
+    circ.measure(1, 1);
+
+    // durations are in ns without dt
+    auto asap = circ;
+    if (schedule(asap, target, SchedulingMethod::ASAP) != 660 || asap.duration() != 660 ||
+        asap.op_start_times() != reg_t({0, 30, 0, 60, 160, 160})) {
+        std::cerr << "  scheduling test : wrong ASAP schedule" << std::endl;
+        return EqualityError;
+    }
+    auto alap = circ;
+    if (schedule(alap, target, SchedulingMethod::ALAP) != 660 || alap.op_start_times() != reg_t({0, 30, 30, 60, 160, 160})) {
+        std::cerr << "  scheduling test : wrong ALAP schedule" << std::endl;
+        return EqualityError;
+    }
+    if (circ.is_scheduled() || !alap.is_scheduled()) {
+        std::cerr << "  scheduling test : start times are shared" << std::endl;
+        return EqualityError;
+    }
+
+    // delays take the duration of their parameter in dt, and qargs not in the target take no time
+    QkCircuit *rust = qk_circuit_new(2, 0);
+    std::uint32_t q0 = 0;
+    std::uint32_t q10[] = {1, 0};
+    qk_circuit_gate(rust, QkGate_X, &q0, nullptr);
+    qk_circuit_delay(rust, 0, 100.0, QkDelayUnit_DT);
+    qk_circuit_gate(rust, QkGate_X, &q0, nullptr);
+    qk_circuit_gate(rust, QkGate_CX, q10, nullptr);
+    auto delayed = QuantumCircuit(2, 0);
+    delayed.set_qiskit_circuit(std::shared_ptr<rust_circuit>(rust, qk_circuit_free), std::vector<uint32_t>({0, 1}));
+    if (schedule(delayed, target, SchedulingMethod::ASAP) != 160 || delayed.op_start_times() != reg_t({0, 30, 130, 160})) {
+        std::cerr << "  scheduling test : wrong schedule of delay" << std::endl;
+        return EqualityError;
+    }
+
+    // start times are aligned with timing constraints
+    auto json = nlohmann::ordered_json::parse(R"({
+        "configuration": {"n_qubits": 1, "max_experiments": 10, "max_shots": 1000, "dt": 1e-9, "basis_gates": ["x"],
+                          "timing_constraints": {"granularity": 1, "min_length": 1, "pulse_alignment": 16, "acquire_alignment": 32}},
+        "properties": {"gates": [{"gate": "x", "qubits": [0], "parameters": [{"name": "gate_error", "value": 0.001}, {"name": "gate_length", "value": 30}]}],
+                       "qubits": [[{"name": "readout_error", "value": 0.01}, {"name": "readout_length", "value": 500}]]}
+    })");
+    Target constrained;
+    if (!constrained.from_json(json) || constrained.pulse_alignment() != 16 || constrained.acquire_alignment() != 32) {
+        std::cerr << "  scheduling test : timing constraints are not loaded" << std::endl;
+        return EqualityError;
+    }
+    auto aligned = QuantumCircuit(1, 1);
+    aligned.x(0);
+    aligned.x(0);
+    aligned.measure(0, 0);
+    if (schedule(aligned, constrained, SchedulingMethod::ASAP) != 564 || aligned.op_start_times() != reg_t({0, 32, 64})) {
+        std::cerr << "  scheduling test : ASAP start times are not aligned" << std::endl;
+        return EqualityError;
+    }
+    if (schedule(aligned, constrained, SchedulingMethod::ALAP) != 576 || aligned.op_start_times() != reg_t({0, 32, 64})) {
+        std::cerr << "  scheduling test : ALAP start times are not aligned" << std::endl;
+        return EqualityError;
+    }
+
+    // scheduling stage of the pass manager
+    auto pass = StagedPassManager(default_stages, constrained, 1, 1.0, 7);
+    pass.set_scheduling_method(SchedulingMethod::ASAP);
+    auto input = QuantumCircuit(1, 1);
+    input.x(0);
+    input.measure(0, 0);
+    auto transpiled = pass.run(input);
+    if (!transpiled.is_scheduled() || transpiled.op_start_times().size() != transpiled.num_instructions()) {
+        std::cerr << "  scheduling test : output of the pass manager is not scheduled" << std::endl;
+        return EqualityError;
+    }
+    return Ok;
+}
+
 
 #if defined(_WIN32)
 int test_transpiler(int argc, char** const argv) {
@@ -129,6 +653,15 @@ int test_transpiler(int argc, char** argv) {
     num_failed += RUN_TEST(test_translate_h);
     num_failed += RUN_TEST(test_translate_cx);
     num_failed += RUN_TEST(test_ghz_routing);
+    num_failed += RUN_TEST(test_subtarget);
+    num_failed += RUN_TEST(test_pack_regions);
+    num_failed += RUN_TEST(test_pack_unpack);
+    num_failed += RUN_TEST(test_transpile_cache);
+    num_failed += RUN_TEST(test_parallel_run);
+    num_failed += RUN_TEST(test_transpiled_template);
+    num_failed += RUN_TEST(test_transpile_stats);
+    num_failed += RUN_TEST(test_user_passes);
+    num_failed += RUN_TEST(test_scheduling);
 
     std::cerr << "=== Number of failed subtests: " << num_failed << std::endl;
     return num_failed;